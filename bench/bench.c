@@ -0,0 +1,324 @@
+#include "../src/kissat.h"
+#include "../src/random.h"
+#include "../src/resources.h"
+
+#include "bench.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_BENCHMARKS 64
+#define MAX_CLAUSE_SIZE 16
+#define MAX_NAME 64
+
+typedef struct benchmark benchmark;
+
+struct benchmark
+{
+  const char *name;
+  const char *unit;
+  void (*function) (bissat_run *);
+  double throughput;
+  double baseline;
+};
+
+static benchmark benchmarks[MAX_BENCHMARKS];
+static unsigned size_benchmarks;
+
+static int runs = 5;
+static double threshold = 35;
+static const char *baseline_path;
+static const char *save_path;
+
+static const char *usage =
+  "usage: bissat [ <option> ... ] [ <pattern> ... ]\n"
+  "\n"
+  "where '<option>' is one of the following\n"
+  "\n"
+  "  -h            print this command line option summary\n"
+  "  -r <runs>     number of runs of each benchmark (default 5)\n"
+  "  -s <file>     save throughput of all benchmarks as baseline\n"
+  "  -b <file>     compare throughput against baseline\n"
+  "  -t <percent>  regression threshold in percent (default 35)\n"
+  "\n"
+  "and '<pattern>' restricts benchmarks to those whose name contains it.\n"
+  "When comparing against a baseline the exit code is '1' if one of the\n"
+  "benchmarks lost more than the threshold of its baseline throughput.\n";
+
+static void
+die (const char *msg, const char *arg)
+{
+  fprintf (stderr, "bissat: error: ");
+  fprintf (stderr, msg, arg);
+  fputc ('\n', stderr);
+  exit (1);
+}
+
+void
+bissat_register (const char *name, const char *unit,
+		 void (*function) (bissat_run *))
+{
+  if (size_benchmarks == MAX_BENCHMARKS)
+    die ("too many benchmarks (increase 'MAX_BENCHMARKS')", 0);
+  benchmark *b = benchmarks + size_benchmarks++;
+  b->name = name;
+  b->unit = unit;
+  b->function = function;
+  b->throughput = b->baseline = -1;
+}
+
+double
+bissat_time (void)
+{
+  return kissat_wall_clock_time ();
+}
+
+/*------------------------------------------------------------------------*/
+
+kissat *
+bissat_init_solver (void)
+{
+  kissat *solver = kissat_init ();
+#if !defined(NOPTIONS) && !defined(QUIET)
+  kissat_set_option (solver, "quiet", 1);
+#endif
+  return solver;
+}
+
+static void
+random_clause (generator * random, unsigned vars, unsigned k, int *lits)
+{
+  assert (k <= vars);
+  assert (k <= MAX_CLAUSE_SIZE);
+  for (unsigned i = 0; i < k; i++)
+    {
+      int idx;
+      bool fresh;
+      do
+	{
+	  idx = 1 + kissat_pick_random (random, 0, vars);
+	  fresh = true;
+	  for (unsigned j = 0; fresh && j < i; j++)
+	    fresh = (abs (lits[j]) != idx);
+	}
+      while (!fresh);
+      lits[i] = kissat_pick_bool (random) ? -idx : idx;
+    }
+}
+
+kissat *
+bissat_random_solver (unsigned vars, unsigned clauses,
+		      unsigned k, uint64_t seed)
+{
+  kissat *solver = bissat_init_solver ();
+  generator random = seed;
+  int lits[MAX_CLAUSE_SIZE];
+  for (unsigned i = 0; i < clauses; i++)
+    {
+      random_clause (&random, vars, k, lits);
+      for (unsigned j = 0; j < k; j++)
+	kissat_add (solver, lits[j]);
+      kissat_add (solver, 0);
+    }
+  return solver;
+}
+
+bool
+bissat_write_random_cnf (const char *path, unsigned vars,
+			 unsigned clauses, unsigned k, uint64_t seed)
+{
+  FILE *file = fopen (path, "w");
+  if (!file)
+    return false;
+  generator random = seed;
+  int lits[MAX_CLAUSE_SIZE];
+  fprintf (file, "p cnf %u %u\n", vars, clauses);
+  for (unsigned i = 0; i < clauses; i++)
+    {
+      random_clause (&random, vars, k, lits);
+      for (unsigned j = 0; j < k; j++)
+	fprintf (file, "%d ", lits[j]);
+      fputs ("0\n", file);
+    }
+  return !fclose (file);
+}
+
+/*------------------------------------------------------------------------*/
+
+static benchmark *
+find_benchmark (const char *name)
+{
+  for (unsigned i = 0; i < size_benchmarks; i++)
+    if (!strcmp (benchmarks[i].name, name))
+      return benchmarks + i;
+  return 0;
+}
+
+static void
+read_baseline (void)
+{
+  FILE *file = fopen (baseline_path, "r");
+  if (!file)
+    die ("can not read baseline '%s'", baseline_path);
+  char name[MAX_NAME];
+  double throughput;
+  while (fscanf (file, "%63s %lf", name, &throughput) == 2)
+    {
+      benchmark *b = find_benchmark (name);
+      if (b)
+	b->baseline = throughput;
+    }
+  fclose (file);
+}
+
+static void
+save_baseline (void)
+{
+  FILE *file = fopen (save_path, "w");
+  if (!file)
+    die ("can not write baseline '%s'", save_path);
+  for (unsigned i = 0; i < size_benchmarks; i++)
+    if (benchmarks[i].throughput >= 0)
+      fprintf (file, "%s %.0f\n",
+	       benchmarks[i].name, benchmarks[i].throughput);
+  fclose (file);
+  printf ("saved baseline to '%s'\n", save_path);
+}
+
+static bool
+match (const char *str, const char *pattern)
+{
+  return strstr (str, pattern) != 0;
+}
+
+static bool
+selected (benchmark * b, int argc, char **argv, int first)
+{
+  if (first == argc)
+    return true;
+  for (int i = first; i < argc; i++)
+    if (match (b->name, argv[i]))
+      return true;
+  return false;
+}
+
+static int
+cmp_runs (const void *p, const void *q)
+{
+  const double s = ((const bissat_run *) p)->time;
+  const double t = ((const bissat_run *) q)->time;
+  return (s > t) - (s < t);
+}
+
+static bool
+run_benchmark (benchmark * b)
+{
+  bissat_run *all = calloc (runs, sizeof *all);
+  if (!all)
+    die ("out of memory allocating %s runs", b->name);
+  for (int i = 0; i < runs; i++)
+    b->function (all + i);
+  qsort (all, runs, sizeof *all, cmp_runs);
+  const bissat_run median = all[runs / 2];
+  free (all);
+  const double throughput = median.time > 0 ? median.ops / median.time : 0;
+  b->throughput = throughput;
+  char unit[MAX_NAME];
+  snprintf (unit, sizeof unit, "M %s/s", b->unit);
+  printf ("%-24s %10.3f %-16s %9.3f s", b->name, throughput * 1e-6,
+	  unit, median.time);
+  bool regression = false;
+  if (b->baseline > 0)
+    {
+      const double change = 100.0 * (throughput / b->baseline - 1);
+      printf (" %+7.1f %%", change);
+      if (change < -threshold)
+	{
+	  printf ("  REGRESSION");
+	  regression = true;
+	}
+    }
+  fputc ('\n', stdout);
+  fflush (stdout);
+  return regression;
+}
+
+int
+main (int argc, char **argv)
+{
+  int first = 1;
+  while (first < argc && argv[first][0] == '-')
+    {
+      const char *arg = argv[first++];
+      if (!strcmp (arg, "-h"))
+	{
+	  fputs (usage, stdout);
+	  return 0;
+	}
+      if (arg[1] && !arg[2] && strchr ("rsbt", arg[1]))
+	{
+	  if (first == argc)
+	    die ("argument to '%s' missing", arg);
+	  const char *val = argv[first++];
+	  if (arg[1] == 'r')
+	    {
+	      if ((runs = atoi (val)) <= 0)
+		die ("invalid number of runs '%s'", val);
+	    }
+	  else if (arg[1] == 's')
+	    save_path = val;
+	  else if (arg[1] == 'b')
+	    baseline_path = val;
+	  else if ((threshold = atof (val)) <= 0)
+	    die ("invalid threshold '%s'", val);
+	}
+      else
+	die ("invalid option '%s' (try '-h')", arg);
+    }
+
+#define SCHEDULE(NAME) \
+do { \
+  void bissat_schedule_ ## NAME (void); \
+  bissat_schedule_ ## NAME (); \
+} while (0)
+
+  SCHEDULE (heap);
+  SCHEDULE (rank);
+  SCHEDULE (vector);
+  SCHEDULE (search);
+  SCHEDULE (parse);
+  SCHEDULE (walk);
+  SCHEDULE (share);
+
+  if (baseline_path)
+    read_baseline ();
+
+  unsigned regressions = 0, executed = 0;
+  for (unsigned i = 0; i < size_benchmarks; i++)
+    {
+      benchmark *b = benchmarks + i;
+      if (!selected (b, argc, argv, first))
+	continue;
+      regressions += run_benchmark (b);
+      executed++;
+    }
+  if (!executed)
+    die ("no benchmark selected", 0);
+
+  if (save_path)
+    save_baseline ();
+
+  if (baseline_path)
+    {
+      if (regressions)
+	printf ("%u regressions beyond %.1f%% of baseline '%s'\n",
+		regressions, threshold, baseline_path);
+      else
+	printf ("no regressions beyond %.1f%% of baseline '%s'\n",
+		threshold, baseline_path);
+    }
+
+  return regressions > 0;
+}
@@ -0,0 +1,50 @@
+#ifndef _bench_h_INCLUDED
+#define _bench_h_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct kissat;
+
+// Each benchmark performs a fixed amount of work with a fixed seed and only
+// measures the time spent in the benchmarked kernel (set-up and clean-up
+// are excluded).  It reports the number of operations and the time through
+// a 'bissat_run'.  The driver in 'bench.c' repeats each benchmark and uses
+// the median run to compute throughput in operations per second, which is
+// less sensitive to noise on shared machines than the fastest run.
+
+typedef struct bissat_run bissat_run;
+
+struct bissat_run
+{
+  uint64_t ops;
+  double time;
+};
+
+void bissat_register (const char *name, const char *unit,
+		      void (*function) (bissat_run *));
+
+#define BENCHMARK(FUNCTION,UNIT) \
+  bissat_register (#FUNCTION, (UNIT), FUNCTION)
+
+double bissat_time (void);
+
+#define START_TIMER() \
+  const double bissat_started = bissat_time ()
+
+#define STOP_TIMER(RUN) \
+  ((RUN)->time = bissat_time () - bissat_started)
+
+// Solvers used in benchmarks should not print messages.
+
+struct kissat *bissat_init_solver (void);
+
+// Uniform random 'k'-SAT formulas shared by several benchmarks, either
+// added directly to a new solver or written to a DIMACS file.
+
+struct kissat *bissat_random_solver (unsigned vars, unsigned clauses,
+				     unsigned k, uint64_t seed);
+bool bissat_write_random_cnf (const char *path, unsigned vars,
+			      unsigned clauses, unsigned k, uint64_t seed);
+
+#endif
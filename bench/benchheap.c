@@ -0,0 +1,64 @@
+#include "../src/inlineheap.h"
+#include "../src/internal.h"
+#include "../src/random.h"
+
+#include "bench.h"
+
+#include <string.h>
+
+// Simulates the access pattern of the variable score heap in stable mode,
+// i.e., popping decision variables from the heap, bumping the scores of
+// analyzed variables with an exponentially increasing score increment and
+// pushing back unassigned variables on backtracking.
+
+#define HEAP_VARS 100000
+#define HEAP_ROUNDS 20000
+#define HEAP_DECISIONS 50
+#define HEAP_BUMPED 40
+
+static void
+bench_heap_bump (bissat_run * run)
+{
+  kissat dummy_solver, *solver = &dummy_solver;
+  memset (solver, 0, sizeof *solver);
+  heap dummy_heap, *heap = &dummy_heap;
+  memset (heap, 0, sizeof *heap);
+  kissat_resize_heap (solver, heap, HEAP_VARS);
+  generator random = 42;
+  unsigned popped[HEAP_DECISIONS];
+  double increment = 1;
+  uint64_t ops = 0;
+  START_TIMER ();
+  for (unsigned idx = 0; idx < HEAP_VARS; idx++)
+    kissat_push_heap (solver, heap, idx);
+  ops += HEAP_VARS;
+  for (unsigned round = 0; round < HEAP_ROUNDS; round++)
+    {
+      for (unsigned i = 0; i < HEAP_DECISIONS; i++)
+	popped[i] = kissat_pop_max_heap (solver, heap);
+      for (unsigned i = 0; i < HEAP_BUMPED; i++)
+	{
+	  const unsigned idx = kissat_pick_random (&random, 0, HEAP_VARS);
+	  const double score = kissat_get_heap_score (heap, idx);
+	  kissat_update_heap (solver, heap, idx, score + increment);
+	}
+      for (unsigned i = 0; i < HEAP_DECISIONS; i++)
+	kissat_push_heap (solver, heap, popped[i]);
+      increment *= 1 / 0.95;
+      if (increment > 1e150)
+	{
+	  kissat_rescale_heap (solver, heap, 1 / increment);
+	  increment = 1;
+	}
+      ops += 2 * HEAP_DECISIONS + HEAP_BUMPED;
+    }
+  STOP_TIMER (run);
+  run->ops = ops;
+  kissat_release_heap (solver, heap);
+}
+
+void
+bissat_schedule_heap (void)
+{
+  BENCHMARK (bench_heap_bump, "ops");
+}
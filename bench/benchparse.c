@@ -0,0 +1,66 @@
+#include "../src/kissat.h"
+#include "../src/parse.h"
+
+#include "bench.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Parsing a random 3-SAT DIMACS file written to the current directory.  The
+// first round is not measured and only brings the file into the page cache.
+
+#define PARSE_PATH "bissat.cnf"
+#define PARSE_VARS 100000
+#define PARSE_ROUNDS 3
+
+static void
+bench_parse_dimacs (bissat_run * run)
+{
+  if (!bissat_write_random_cnf (PARSE_PATH, PARSE_VARS,
+				4.2 * PARSE_VARS, 3, 42))
+    {
+      fprintf (stderr, "bissat: error: can not write '%s'\n", PARSE_PATH);
+      exit (1);
+    }
+  double time = 0;
+  uint64_t bytes = 0;
+  for (unsigned round = 0; round <= PARSE_ROUNDS; round++)
+    {
+      kissat *solver = bissat_init_solver ();
+      file file;
+      if (!kissat_open_to_read_file (&file, PARSE_PATH))
+	{
+	  fprintf (stderr, "bissat: error: can not read '%s'\n", PARSE_PATH);
+	  exit (1);
+	}
+      uint64_t lineno;
+      int max_var;
+      START_TIMER ();
+      const char *error = kissat_parse_dimacs (solver, NORMAL_PARSING,
+					       &file, &lineno, &max_var);
+      const double delta = bissat_time () - bissat_started;
+      if (error)
+	{
+	  fprintf (stderr, "bissat: error: %s:%" PRIu64 ": %s\n",
+		   PARSE_PATH, lineno, error);
+	  exit (1);
+	}
+      if (round)
+	{
+	  time += delta;
+	  bytes += file.bytes;
+	}
+      kissat_close_file (&file);
+      kissat_release (solver);
+    }
+  remove (PARSE_PATH);
+  run->ops = bytes;
+  run->time = time;
+}
+
+void
+bissat_schedule_parse (void)
+{
+  BENCHMARK (bench_parse_dimacs, "bytes");
+}
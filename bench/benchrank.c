@@ -0,0 +1,81 @@
+#include "../src/allocate.h"
+#include "../src/internal.h"
+#include "../src/random.h"
+#include "../src/rank.h"
+
+#include "bench.h"
+
+#include <string.h>
+
+#define ROUNDS 10
+#define ELEMENTS (1u << 20)
+
+// Radix sorting with 'RADIX_STACK' of random 32-bit keys and of variables
+// ranked by their enqueue stamps, as in 'sort_bump' before bumping.
+
+static void
+bench_rank_unsigneds (bissat_run * run)
+{
+  kissat dummy_solver, *solver = &dummy_solver;
+  memset (solver, 0, sizeof *solver);
+  unsigneds stack;
+  INIT_STACK (stack);
+  generator random = 42;
+  double time = 0;
+  for (unsigned round = 0; round < ROUNDS; round++)
+    {
+      CLEAR_STACK (stack);
+      for (unsigned i = 0; i < ELEMENTS; i++)
+	PUSH_STACK (stack, kissat_next_random32 (&random));
+      START_TIMER ();
+#define RANK_UNSIGNED(A) (A)
+      RADIX_STACK (unsigned, unsigned, stack, RANK_UNSIGNED);
+      time += bissat_time () - bissat_started;
+    }
+  run->ops = (uint64_t) ROUNDS * ELEMENTS;
+  run->time = time;
+  RELEASE_STACK (stack);
+#ifndef QUIET
+  RELEASE_STACK (solver->profiles.stack);
+#endif
+}
+
+static void
+bench_rank_stamps (bissat_run * run)
+{
+  kissat dummy_solver, *solver = &dummy_solver;
+  memset (solver, 0, sizeof *solver);
+  dataranks stack;
+  INIT_STACK (stack);
+  generator random = 42;
+  double time = 0;
+  for (unsigned round = 0; round < ROUNDS; round++)
+    {
+      CLEAR_STACK (stack);
+      for (unsigned i = 0; i < ELEMENTS; i++)
+	{
+	  const datarank element = {
+	    .data = i,
+	    .rank = kissat_pick_random (&random, 0, 16 * ELEMENTS)
+	  };
+	  PUSH_STACK (stack, element);
+	}
+      START_TIMER ();
+#define RANK_STAMP(A) ((A).rank)
+      RADIX_STACK (datarank, unsigned, stack, RANK_STAMP);
+      time += bissat_time () - bissat_started;
+    }
+  run->ops = (uint64_t) ROUNDS * ELEMENTS;
+  run->time = time;
+  RELEASE_STACK (stack);
+#ifndef QUIET
+  RELEASE_STACK (solver->profiles.stack);
+#endif
+}
+
+void
+bissat_schedule_rank (void)
+{
+  BENCHMARK (bench_rank_unsigneds, "elements");
+  BENCHMARK (bench_rank_stamps, "elements");
+}
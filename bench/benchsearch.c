@@ -0,0 +1,115 @@
+#include "../src/analyze.h"
+#include "../src/backtrack.h"
+#include "../src/decide.h"
+#include "../src/internal.h"
+#include "../src/propsearch.h"
+#include "../src/random.h"
+
+#include "bench.h"
+
+// The benchmarks use uniform random 3-SAT formulas close to the threshold
+// (ratio 4.2), where most propagations visit ternary clause watches.  The
+// propagation benchmark is also run on random 7-SAT formulas (ratio 85),
+// where computing the assignment level of forced literals has to go
+// through the levels of six other literals.
+
+#define PROPAGATE_VARS 100000
+#define PROPAGATE_ROUNDS 100
+
+#define PROPAGATE_LARGE_VARS 5000
+#define PROPAGATE_LARGE_ROUNDS 50
+
+// Propagation only: assume random literals until a conflict occurs or all
+// variables are assigned, then backtrack to the root level and start over.
+
+static void
+propagate_random_decisions (bissat_run * run, unsigned vars,
+			    double ratio, unsigned k, unsigned rounds)
+{
+  const unsigned clauses = ratio * vars;
+  kissat *solver = bissat_random_solver (vars, clauses, k, 42);
+  generator random = 42;
+  const uint64_t before = solver->statistics.propagations;
+  START_TIMER ();
+  for (unsigned round = 0; round < rounds; round++)
+    {
+      while (solver->unassigned)
+	{
+	  unsigned idx;
+	  do
+	    idx = kissat_pick_random (&random, 0, solver->vars);
+	  while (solver->values[LIT (idx)]);
+	  const unsigned lit = kissat_pick_bool (&random) ? LIT (idx) :
+	    NOT (LIT (idx));
+	  kissat_internal_assume (solver, lit);
+	  if (kissat_search_propagate (solver))
+	    break;
+	}
+      kissat_backtrack_in_consistent_state (solver, 0);
+    }
+  STOP_TIMER (run);
+  run->ops = solver->statistics.propagations - before;
+  kissat_release (solver);
+}
+
+static void
+bench_search_propagate (bissat_run * run)
+{
+  propagate_random_decisions (run, PROPAGATE_VARS, 4.2, 3,
+			      PROPAGATE_ROUNDS);
+}
+
+static void
+bench_search_propagate_large (bissat_run * run)
+{
+  propagate_random_decisions (run, PROPAGATE_LARGE_VARS, 85, 7,
+			      PROPAGATE_LARGE_ROUNDS);
+}
+
+#define ANALYZE_VARS 5000
+#define ANALYZE_CONFLICTS 10000
+
+// Conflict analysis including learned clause minimization and shrinking
+// (and bumping) in focused mode without restarts, reductions and other
+// interruptions.  Only the time spent in 'kissat_analyze' is measured.
+
+static void
+bench_search_analyze (bissat_run * run)
+{
+  const unsigned clauses = 4.2 * ANALYZE_VARS;
+  kissat *solver = bissat_random_solver (ANALYZE_VARS, clauses, 3, 42);
+  kissat_init_averages (solver, &AVERAGES);
+  const unsigned eagersubsume = GET_OPTION (eagersubsume);
+  if (eagersubsume)
+    kissat_init_clueue (solver, &solver->clueue, eagersubsume);
+  double time = 0;
+  uint64_t analyzed = 0;
+  while (analyzed < ANALYZE_CONFLICTS)
+    {
+      clause *conflict = kissat_search_propagate (solver);
+      if (conflict)
+	{
+	  START_TIMER ();
+	  const int res = kissat_analyze (solver, conflict);
+	  time += bissat_time () - bissat_started;
+	  analyzed++;
+	  if (res)
+	    break;
+	}
+      else if (!solver->unassigned)
+	kissat_backtrack_in_consistent_state (solver, 0);
+      else
+	kissat_decide (solver);
+    }
+  run->ops = analyzed;
+  run->time = time;
+  kissat_release (solver);
+}
+
+void
+bissat_schedule_search (void)
+{
+  BENCHMARK (bench_search_propagate, "propagations");
+  BENCHMARK (bench_search_propagate_large, "propagations");
+  BENCHMARK (bench_search_analyze, "conflicts");
+}
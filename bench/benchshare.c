@@ -0,0 +1,119 @@
+#include "../src/internal.h"
+
+#include "bench.h"
+
+#include <string.h>
+
+// Clause sharing of a single solver with itself through the export and
+// import callbacks, either asynchronously (imported clauses are those
+// exported since the last import) or deterministically at the end of
+// epochs of 'SHARE_EPOCH' ticks.  Comparing the throughput of both
+// benchmarks quantifies the overhead of deterministic sharing, i.e.,
+// forced backtracking to the root level, buffering of exported clauses
+// and the canonical ordering of imported clauses.
+
+#define SHARE_VARS 400
+#define SHARE_CONFLICTS 30000
+#define SHARE_EPOCH 20000
+#define SHARE_SIZE 8
+
+typedef struct loopback loopback;
+
+struct loopback
+{
+  kissat *solver;
+  int buffer[SHARE_SIZE];
+  int clause[SHARE_SIZE];
+  ints exported;
+  ints ready;
+  size_t next;
+};
+
+static void
+consume (void *state, int size, int glue)
+{
+  loopback *host = state;
+  kissat *solver = host->solver;
+  PUSH_STACK (host->exported, size);
+  PUSH_STACK (host->exported, glue);
+  for (int i = 0; i < size; i++)
+    PUSH_STACK (host->exported, host->buffer[i]);
+}
+
+static void
+barrier (void *state, unsigned long epoch)
+{
+  loopback *host = state;
+  kissat *solver = host->solver;
+  CLEAR_STACK (host->ready);
+  for (all_stack (int, lit, host->exported))
+    PUSH_STACK (host->ready, lit);
+  CLEAR_STACK (host->exported);
+  host->next = 0;
+  (void) epoch;
+}
+
+static void
+produce (void *state, int **clause, int *size, int *glue)
+{
+  loopback *host = state;
+  if (!host->solver->share.barrier && host->next == SIZE_STACK (host->ready))
+    barrier (host, 0);
+  if (host->next == SIZE_STACK (host->ready))
+    {
+      *clause = 0, *size = *glue = 0;
+      return;
+    }
+  const int *c = BEGIN_STACK (host->ready) + host->next;
+  *size = c[0], *glue = c[1];
+  memcpy (host->clause, c + 2, c[0] * sizeof *c);
+  host->next += c[0] + 2;
+  *clause = host->clause;
+}
+
+static void
+bench_share (bissat_run * run, bool deterministic)
+{
+  const unsigned clauses = 4.26 * SHARE_VARS;
+  kissat *solver = bissat_random_solver (SHARE_VARS, clauses, 3, 42);
+  loopback host;
+  memset (&host, 0, sizeof host);
+  host.solver = solver;
+  kissat_set_clause_export_callback (solver, &host, host.buffer,
+				     SHARE_SIZE, consume);
+  kissat_set_clause_import_callback (solver, &host, produce);
+  if (deterministic)
+    {
+#ifndef NOPTIONS
+      solver->options.shareepoch = SHARE_EPOCH;
+#endif
+      kissat_set_clause_sharing_barrier (solver, &host, barrier);
+    }
+  kissat_set_conflict_limit (solver, SHARE_CONFLICTS);
+  START_TIMER ();
+  kissat_solve (solver);
+  STOP_TIMER (run);
+  run->ops = solver->statistics.conflicts;
+  RELEASE_STACK (host.exported);
+  RELEASE_STACK (host.ready);
+  kissat_release (solver);
+}
+
+static void
+bench_share_asynchronous (bissat_run * run)
+{
+  bench_share (run, false);
+}
+
+static void
+bench_share_deterministic (bissat_run * run)
+{
+  bench_share (run, true);
+}
+
+void
+bissat_schedule_share (void)
+{
+  BENCHMARK (bench_share_asynchronous, "conflicts");
+  BENCHMARK (bench_share_deterministic, "conflicts");
+}
@@ -0,0 +1,59 @@
+#include "../src/allocate.h"
+#include "../src/inlinevector.h"
+#include "../src/internal.h"
+#include "../src/random.h"
+
+#include "bench.h"
+
+#include <string.h>
+
+// Watch list like growth of many vectors on the shared vectors stack which
+// exercises 'kissat_enlarge_vector' and its reuse of free blocks.  Every
+// fourth operation removes an element instead and the vectors are defragmented
+// as in 'kissat_defrag_watches_if_needed' with the default 'defraglim' and
+// 'defragsize' limits.
+
+#define VECTORS 200000
+#define OPERATIONS 8000000
+#define DEFRAG_LIMIT 75
+#define DEFRAG_SIZE (1u << 18)
+
+static void
+bench_vector_enlarge (bissat_run * run)
+{
+  kissat dummy_solver, *solver = &dummy_solver;
+  memset (solver, 0, sizeof *solver);
+  vector *vectors;
+  CALLOC (vectors, VECTORS);
+  solver->size = solver->vars = VECTORS / 2;
+  solver->watches = vectors;
+  generator random = 42;
+  START_TIMER ();
+  for (unsigned i = 0; i < OPERATIONS; i++)
+    {
+      const unsigned pick = kissat_next_random32 (&random);
+      const unsigned j = pick % VECTORS;
+      vector *vector = vectors + j;
+      if ((pick >> 30) || kissat_empty_vector (vector))
+	kissat_push_vectors (solver, vector, j);
+      else
+	kissat_remove_from_vector (solver, vector, j);
+      const size_t size = SIZE_STACK (solver->vectors.stack);
+      if (size > DEFRAG_SIZE &&
+	  solver->vectors.usable > size * DEFRAG_LIMIT / 100)
+	kissat_defrag_vectors (solver, VECTORS, vectors);
+    }
+  STOP_TIMER (run);
+  run->ops = OPERATIONS;
+  kissat_release_vectors (solver);
+  DEALLOC (vectors, VECTORS);
+#ifndef QUIET
+  RELEASE_STACK (solver->profiles.stack);
+#endif
+}
+
+void
+bissat_schedule_vector (void)
+{
+  BENCHMARK (bench_vector_enlarge, "ops");
+}
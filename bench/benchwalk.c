@@ -0,0 +1,47 @@
+#include "../src/internal.h"
+
+#include "bench.h"
+
+// Local search flips of the initial walk ('--walkinitially') on a random
+// 3-SAT formula slightly below the threshold.  The conflict limit is zero,
+// which makes 'kissat_solve' return right after walking.  Enabling the walk
+// needs options.  Flips are only counted with statistics enabled, otherwise
+// walking steps are used instead.
+
+#ifndef NOPTIONS
+
+#ifdef STATISTICS
+#define WALK_OPS flipped
+#else
+#define WALK_OPS walk_steps
+#endif
+
+#define WALK_VARS 50000
+
+static void
+bench_walk_flips (bissat_run * run)
+{
+  kissat *solver = bissat_random_solver (WALK_VARS, 4.1 * WALK_VARS, 3, 42);
+  kissat_set_option (solver, "walkinitially", 1);
+  kissat_set_option (solver, "walkeffort", 1e6);
+  kissat_set_conflict_limit (solver, 0);
+  START_TIMER ();
+  (void) kissat_solve (solver);
+  STOP_TIMER (run);
+  run->ops = solver->statistics.WALK_OPS;
+  kissat_release (solver);
+}
+
+#endif
+
+void
+bissat_schedule_walk (void)
+{
+#ifndef NOPTIONS
+#ifdef STATISTICS
+  BENCHMARK (bench_walk_flips, "flips");
+#else
+  BENCHMARK (bench_walk_flips, "steps");
+#endif
+#endif
+}
@@ -0,0 +1,339 @@
+#include <ctype.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *usage =
+  "usage: gencnf [ -h ] <family> <size> [ <seed> ]\n"
+  "\n"
+  "where '<family>' is one of the following\n"
+  "\n"
+  "  random  uniform random 3-SAT at the threshold ('<size>' variables)\n"
+  "  php     pigeon hole principle ('<size>' holes, unsatisfiable)\n"
+  "  parity  two permuted XOR chains over '<size>' inputs (unsatisfiable)\n"
+  "  bmc     counter circuit unrolled for '<size>' time frames\n"
+  "  easy    planted 3-SAT below the threshold ('<size>' variables)\n"
+  "\n"
+  "Sizes and seeds can be written as '<digits>[e<digit>]' (e.g., '1e7').\n"
+  "The formula is written in DIMACS format to '<stdout>'.\n";
+
+static void
+die (const char *msg, const char *arg)
+{
+  fprintf (stderr, "gencnf: error: ");
+  fprintf (stderr, msg, arg);
+  fputc ('\n', stderr);
+  exit (1);
+}
+
+static int
+parse (const char *arg)
+{
+  const char *p = arg;
+  char ch = *p++;
+  if (!isdigit (ch))
+    die ("expected digit in '%s'", arg);
+  int res = ch - '0';
+  while (isdigit (ch = *p++))
+    {
+      if (INT_MAX / 10 < res)
+	die ("number '%s' too large", arg);
+      res *= 10;
+      int digit = ch - '0';
+      if (INT_MAX - digit < res)
+	die ("number '%s' too large", arg);
+      res += digit;
+    }
+  if (ch == 'e')
+    {
+      ch = *p++;
+      if (!isdigit (ch) || *p)
+	die ("invalid exponent in '%s'", arg);
+      for (int exp = ch - '0'; exp; exp--)
+	{
+	  if (INT_MAX / 10 < res)
+	    die ("number '%s' too large", arg);
+	  res *= 10;
+	}
+    }
+  else if (ch)
+    die ("expected digit or 'e' in '%s'", arg);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Generators are run twice with the same seed.  The first pass only
+// counts variables and clauses for the header and the second prints them.
+
+static bool printing;
+static int variables;
+static uint64_t clauses;
+static uint64_t state;
+
+static uint64_t
+next (void)
+{
+  state *= 6364136223846793005ul;
+  state += 1442695040888963407ul;
+  return state;
+}
+
+static unsigned
+pick (unsigned range)
+{
+  return (next () >> 32) % range;
+}
+
+static void
+literal (int lit)
+{
+  const int idx = abs (lit);
+  if (idx > variables)
+    variables = idx;
+  if (printing)
+    printf ("%d ", lit);
+}
+
+static void
+clause (void)
+{
+  clauses++;
+  if (printing)
+    fputs ("0\n", stdout);
+}
+
+static void
+unit (int a)
+{
+  literal (a), clause ();
+}
+
+static void
+binary (int a, int b)
+{
+  literal (a), literal (b), clause ();
+}
+
+static void
+ternary (int a, int b, int c)
+{
+  literal (a), literal (b), literal (c), clause ();
+}
+
+static void
+xor_gate (int lhs, int a, int b)
+{
+  ternary (-lhs, a, b);
+  ternary (-lhs, -a, -b);
+  ternary (lhs, -a, b);
+  ternary (lhs, a, -b);
+}
+
+static void
+and_gate (int lhs, int a, int b)
+{
+  binary (-lhs, a);
+  binary (-lhs, b);
+  ternary (lhs, -a, -b);
+}
+
+static void
+random_3sat (int vars, int size, int planted)
+{
+  for (int i = 0; i < size; i++)
+    {
+      int lits[3];
+      for (int j = 0; j < 3; j++)
+	{
+	  int idx;
+	  bool fresh;
+	  do
+	    {
+	      idx = 1 + pick (vars);
+	      fresh = true;
+	      for (int k = 0; fresh && k < j; k++)
+		fresh = (abs (lits[k]) != idx);
+	    }
+	  while (!fresh);
+	  lits[j] = pick (2) ? -idx : idx;
+	}
+      if (planted)
+	{
+	  // The planted solution assigns odd variables to true and even
+	  // variables to false.  Clauses falsified by it get one literal
+	  // flipped.
+
+	  bool satisfied = false;
+	  for (int j = 0; !satisfied && j < 3; j++)
+	    satisfied = ((lits[j] > 0) == (abs (lits[j]) & 1));
+	  if (!satisfied)
+	    {
+	      const int j = pick (3);
+	      lits[j] = -lits[j];
+	    }
+	}
+      ternary (lits[0], lits[1], lits[2]);
+    }
+}
+
+static void
+random_family (int n)
+{
+  if (n < 3)
+    die ("'random' needs at least '3' variables", 0);
+  random_3sat (n, 4.26 * n + 0.5, false);
+}
+
+static void
+easy_family (int n)
+{
+  if (n < 3)
+    die ("'easy' needs at least '3' variables", 0);
+  random_3sat (n, 2 * n, true);
+}
+
+static void
+php_family (int holes)
+{
+  if (!holes)
+    die ("'php' needs at least one hole", 0);
+  const int pigeons = holes + 1;
+#define PIGEON_IN_HOLE(P,H) (1 + (P) * holes + (H))
+  for (int p = 0; p < pigeons; p++)
+    {
+      for (int h = 0; h < holes; h++)
+	literal (PIGEON_IN_HOLE (p, h));
+      clause ();
+    }
+  for (int h = 0; h < holes; h++)
+    for (int p = 0; p < pigeons; p++)
+      for (int q = p + 1; q < pigeons; q++)
+	binary (-PIGEON_IN_HOLE (p, h), -PIGEON_IN_HOLE (q, h));
+}
+
+static void
+parity_family (int n)
+{
+  if (n < 2)
+    die ("'parity' needs at least '2' inputs", 0);
+  int *perm = malloc (n * sizeof *perm);
+  if (!perm)
+    die ("out of memory", 0);
+  for (int i = 0; i < n; i++)
+    perm[i] = i + 1;
+  for (int i = n - 1; i > 0; i--)
+    {
+      const int j = pick (i + 1);
+      const int tmp = perm[i];
+      perm[i] = perm[j];
+      perm[j] = tmp;
+    }
+  int first = 1, second = perm[0];
+  int next_variable = n + 1;
+  for (int i = 1; i < n; i++)
+    {
+      const int a = next_variable++;
+      xor_gate (a, first, i + 1);
+      first = a;
+      const int b = next_variable++;
+      xor_gate (b, second, perm[i]);
+      second = b;
+    }
+  binary (first, second);
+  binary (-first, -second);
+  free (perm);
+}
+
+static void
+bmc_family (int frames)
+{
+  if (!frames)
+    die ("'bmc' needs at least one frame", 0);
+  int width = 1;
+  while (width < 31 && (1 << width) <= frames)
+    width++;
+  // Bit 'i' of the counter in frame 't' followed by enable inputs and the
+  // carries of the incrementer in each transition.
+#define STATE(T,I) (1 + (T) * width + (I))
+  int next_variable = STATE (frames + 1, 0);
+  for (int i = 0; i < width; i++)
+    unit (-STATE (0, i));
+  for (int t = 0; t < frames; t++)
+    {
+      int carry = next_variable++;
+      for (int i = 0; i < width; i++)
+	{
+	  xor_gate (STATE (t + 1, i), STATE (t, i), carry);
+	  if (i + 1 == width)
+	    break;
+	  const int next_carry = next_variable++;
+	  and_gate (next_carry, STATE (t, i), carry);
+	  carry = next_carry;
+	}
+    }
+  // The bad state is reachable by enabling exactly half of the transitions.
+  const int target = frames / 2;
+  for (int i = 0; i < width; i++)
+    {
+      const int lit = STATE (frames, i);
+      unit ((target & (1 << i)) ? lit : -lit);
+    }
+}
+
+/*------------------------------------------------------------------------*/
+
+int
+main (int argc, char **argv)
+{
+  const char *family = 0;
+  int size = -1, seed = 0;
+  for (int i = 1; i < argc; i++)
+    {
+      const char *arg = argv[i];
+      if (!strcmp (arg, "-h"))
+	{
+	  fputs (usage, stdout);
+	  return 0;
+	}
+      if (arg[0] == '-')
+	die ("invalid option '%s' (try '-h')", arg);
+      if (!family)
+	family = arg;
+      else if (size < 0)
+	size = parse (arg);
+      else if (!seed)
+	seed = parse (arg);
+      else
+	die ("too many arguments (try '-h')", 0);
+    }
+  if (!family)
+    die ("family missing (try '-h')", 0);
+  if (size < 0)
+    die ("size missing (try '-h')", 0);
+  void (*generate) (int);
+  if (!strcmp (family, "random"))
+    generate = random_family;
+  else if (!strcmp (family, "php"))
+    generate = php_family;
+  else if (!strcmp (family, "parity"))
+    generate = parity_family;
+  else if (!strcmp (family, "bmc"))
+    generate = bmc_family;
+  else if (!strcmp (family, "easy"))
+    generate = easy_family;
+  else
+    die ("unknown family '%s' (try '-h')", family);
+  state = seed;
+  generate (size);
+  printf ("c gencnf %s %d %d\n", family, size, seed);
+  printf ("p cnf %d %" PRIu64 "\n", variables, clauses);
+  printing = true;
+  state = seed;
+  generate (size);
+  return 0;
+}
@@ -0,0 +1,132 @@
+#!/bin/sh
+
+cd "`dirname $0`" || exit 1
+binary="`basename $0`"
+
+usage () {
+cat <<EOF
+usage: $binary [ <option> ... ] [ <family>[:<size>] ... ]
+
+where '<option>' is one of the following
+
+  -h             print this command line option summary
+  -k <kissat>    solver binary (default '../../build/kissat')
+  -t <seconds>   time limit per instance (default 60)
+  -l             include large sizes (tens of millions of clauses)
+  -s <seed>      seed passed to the generator (default 0)
+
+Without '<size>' all default sizes of a family are run and without any
+family all families are run ('random', 'php', 'parity', 'bmc', 'easy').
+Instances are generated with 'gencnf' into a temporary file.  For each
+instance the runner reports the result, parse and simplification time,
+conflicts and propagations per second, peak resident set size and process
+time, as printed by a non-quiet 'kissat' with default profiling level.
+EOF
+exit 0
+}
+
+die () {
+  echo "$binary: error: $*" 1>&2
+  exit 1
+}
+
+kissat=../../build/kissat
+limit=60
+large=no
+seed=0
+instances=""
+
+while [ $# -gt 0 ]
+do
+  case "$1" in
+    -h) usage;;
+    -k) shift; [ $# -gt 0 ] || die "argument to '-k' missing"; kissat="$1";;
+    -t) shift; [ $# -gt 0 ] || die "argument to '-t' missing"; limit="$1";;
+    -l) large=yes;;
+    -s) shift; [ $# -gt 0 ] || die "argument to '-s' missing"; seed="$1";;
+    -*) die "invalid option '$1' (try '-h')";;
+    *) instances="$instances $1";;
+  esac
+  shift
+done
+
+[ -x "$kissat" ] || die "can not find solver binary '$kissat' (use '-k')"
+make -s gencnf 1>&2 || die "could not build 'gencnf'"
+
+sizes () {
+  case "$1" in
+    random) echo "150 200 250"; [ $large = yes ] && echo "300";;
+    php) echo "8 9 10"; [ $large = yes ] && echo "11";;
+    parity) echo "20 24 28"; [ $large = yes ] && echo "32";;
+    bmc) echo "500 1000 2000"; [ $large = yes ] && echo "10000";;
+    easy) echo "1e5 1e6"; [ $large = yes ] && echo "1e7";;
+    *) die "unknown family '$1'";;
+  esac
+  return 0
+}
+
+if [ -z "$instances" ]
+then
+  for family in random php parity bmc easy
+  do
+    for size in `sizes $family`
+    do
+      instances="$instances $family:$size"
+    done
+  done
+else
+  expanded=""
+  for instance in $instances
+  do
+    family="`echo $instance|sed -e 's,:.*,,'`"
+    list="`sizes $family`" || exit 1
+    case "$instance" in
+      *:*) expanded="$expanded $instance";;
+      *) for size in $list
+	 do
+	   expanded="$expanded $instance:$size"
+	 done;;
+    esac
+  done
+  instances="$expanded"
+fi
+
+tmp=/tmp/kissat-scale-$$
+trap "rm -f $tmp.*; exit 1" 1 2 3 15
+
+printf "%-7s %6s %9s %10s %6s %8s %8s %12s %12s %8s %9s\n" \
+  family size variables clauses result parse simplify \
+  conflicts/s props/s MB seconds
+
+for instance in $instances
+do
+  family="`echo $instance|sed -e 's,:.*,,'`"
+  size="`echo $instance|sed -e 's,.*:,,'`"
+  ./gencnf $family $size $seed > $tmp.cnf || die "generating '$instance' failed"
+  $kissat --time=$limit $tmp.cnf < /dev/null > $tmp.log 2>&1
+  awk -v family=$family -v size=$size '
+/^c parsed .p cnf/ { variables = $5; clauses = $6 }
+/^s SATISFIABLE/ { result = "sat" }
+/^s UNSATISFIABLE/ { result = "unsat" }
+/^c .*%  parse$/ { parse = $2 }
+/^c .*%  simplify$/ { simplify = $2 }
+/^c conflicts:/ { conflicts = $4 }
+/^c propagations:/ { propagations = $4 }
+/^c maximum-resident-set-size:/ { rss = $5 }
+/^c process-time:/ { seconds = $(NF-1) }
+END {
+  sub (/'"'"'/, "", clauses)
+  printf "%-7s %6s %9s %10s %6s %8s %8s %12s %12s %8s %9s\n",
+    family, size,
+    variables == "" ? "-" : variables,
+    clauses == "" ? "-" : clauses,
+    result == "" ? "unknown" : result,
+    parse == "" ? "-" : parse,
+    simplify == "" ? "-" : simplify,
+    conflicts == "" ? "-" : conflicts,
+    propagations == "" ? "-" : propagations,
+    rss == "" ? "-" : rss,
+    seconds == "" ? "-" : seconds
+}' $tmp.log
+  rm -f $tmp.cnf $tmp.log
+done
@@ -12,12 +12,26 @@
 #include <inttypes.h>
 #endif
 
+const char *kissat_memory_category_names[SIZE_MEMORY_CATEGORIES] = {
+#define MEMORY_CATEGORY(NAME) #NAME,
+  MEMORY_CATEGORIES
+#undef MEMORY_CATEGORY
+};
+
 static void
 inc_bytes (kissat * solver, size_t bytes)
 {
-#ifdef METRICS
   if (!solver)
     return;
+  memory *memory = &solver->memory;
+  const unsigned category = memory->category;
+  assert (category < SIZE_MEMORY_CATEGORIES);
+  const uint64_t current = (memory->current[category] += bytes);
+  if (current > memory->maximum[category])
+    memory->maximum[category] = current;
+  if ((memory->total += bytes) > memory->peak)
+    memory->peak = memory->total;
+#ifdef METRICS
   ADD (allocated_current, bytes);
   LOG5 ("allocated_current = %s",
 	FORMAT_BYTES (solver->statistics.allocated_current));
@@ -28,24 +42,25 @@ inc_bytes (kissat * solver, size_t bytes)
       LOG5 ("allocated_max = %s",
 	    FORMAT_BYTES (solver->statistics.allocated_max));
     }
-#else
-  (void) solver;
-  (void) bytes;
 #endif
 }
 
 static void
 dec_bytes (kissat * solver, size_t bytes)
 {
-#ifdef METRICS
   if (!solver)
     return;
+  memory *memory = &solver->memory;
+  const unsigned category = memory->category;
+  assert (category < SIZE_MEMORY_CATEGORIES);
+  assert (memory->current[category] >= bytes);
+  memory->current[category] -= bytes;
+  assert (memory->total >= bytes);
+  memory->total -= bytes;
+#ifdef METRICS
   SUB (allocated_current, bytes);
   LOG5 ("allocated_current = %s",
 	FORMAT_BYTES (solver->statistics.allocated_current));
-#else
-  (void) solver;
-  (void) bytes;
 #endif
 }
 
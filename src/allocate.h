@@ -1,10 +1,58 @@
 #ifndef _allocate_h_INCLUDED
 #define _allocate_h_INCLUDED
 
+#include <stdint.h>
 #include <stdlib.h>
 
 struct kissat;
 
+// Allocated bytes are accounted to the current memory category of the
+// solver.  It is 'other' by default and only switched with 'START_MEMORY'
+// and 'STOP_MEMORY' while the data structures with their own category are
+// enlarged, shrunken or released.  Thus bytes of each block are always
+// accounted to the same category at allocation and deallocation time.
+
+#define MEMORY_CATEGORIES \
+MEMORY_CATEGORY (other) \
+MEMORY_CATEGORY (arena) \
+MEMORY_CATEGORY (cache) \
+MEMORY_CATEGORY (extend) \
+MEMORY_CATEGORY (kitten) \
+MEMORY_CATEGORY (walker) \
+MEMORY_CATEGORY (watches)
+
+enum memory_category
+{
+#define MEMORY_CATEGORY(NAME) MEMORY_ ## NAME,
+  MEMORY_CATEGORIES
+#undef MEMORY_CATEGORY
+  SIZE_MEMORY_CATEGORIES
+};
+
+typedef struct memory memory;
+
+struct memory
+{
+  uint64_t current[SIZE_MEMORY_CATEGORIES];
+  uint64_t maximum[SIZE_MEMORY_CATEGORIES];
+  uint64_t total, peak;
+  unsigned category;
+  unsigned degraded;
+};
+
+#define START_MEMORY(CATEGORY) \
+  const unsigned saved_ ## CATEGORY ## _memory_category = \
+    solver->memory.category; \
+  solver->memory.category = MEMORY_ ## CATEGORY
+
+#define STOP_MEMORY(CATEGORY) \
+do { \
+  assert (solver->memory.category == MEMORY_ ## CATEGORY); \
+  solver->memory.category = saved_ ## CATEGORY ## _memory_category; \
+} while (0)
+
+extern const char *kissat_memory_category_names[SIZE_MEMORY_CATEGORIES];
+
 void *kissat_malloc (struct kissat *, size_t bytes);
 void kissat_free (struct kissat *, void *, size_t bytes);
 
@@ -20,6 +68,11 @@ do { \
   (P) = kissat_calloc (solver, (N), sizeof *(P)); \
 } while (0)
 
+#define NALLOC(P,N) \
+do { \
+  (P) = kissat_nalloc (solver, (N), sizeof *(P)); \
+} while (0)
+
 #define DEALLOC(P,N) \
 do { \
   kissat_dealloc (solver, (P), (N), sizeof *(P)); \
@@ -27,10 +27,15 @@ struct application
 #endif
 #if !defined(NPROOFS) || !defined (_POSIX_C_SOURCE)
   bool force;
+#endif
+#if (!defined(QUIET) || defined(COUNTERS)) && !defined(NOPTIONS)
+  const char *trace_path;
 #endif
   int time;
   int conflicts;
   int decisions;
+  int memory;
+  int ticks;
   strictness strict;
   bool partial;
   bool witness;
@@ -46,6 +51,7 @@ init_app (application * application, kissat * solver)
   application->time = 0;
   application->conflicts = -1;
   application->decisions = -1;
+  application->ticks = -1;
   application->strict = NORMAL_PARSING;
 }
 
@@ -208,12 +214,18 @@ print_complete_usage (void)
 	  " (ignore DIMACS header)\n");
   printf ("  --strict             stricter parsing"
 	  " (no empty header lines)\n");
+#if (!defined(QUIET) || defined(COUNTERS)) && !defined(NOPTIONS)
+  printf ("  --trace=<file>       write event trace"
+	  " (Chrome trace format)\n");
+#endif
   printf ("  --version            print version\n");
   printf ("\n");
   printf ("The following solving limits can be enforced:\n");
   printf ("\n");
   printf ("  --conflicts=<limit>\n");
   printf ("  --decisions=<limit>\n");
+  printf ("  --memory=<megabytes>\n");
+  printf ("  --ticks=<limit>\n");
   printf ("  --time=<seconds>\n");
   printf ("\n");
   printf
@@ -537,6 +549,47 @@ parse_options (application * application, int argc, char **argv)
 	  else
 	    ERROR ("invalid argument in '%s' (try '-h')", arg);
 	}
+      else if ((valstr = kissat_parse_option_name (arg, "ticks")))
+	{
+	  int val;
+	  if (kissat_parse_option_value (valstr, &val) && val >= 0)
+	    {
+	      if (application->ticks >= 0)
+		ERROR ("multiple '--ticks=%d' and '%s'",
+		       application->ticks, arg);
+	      kissat_set_ticks_limit (solver, val);
+	      application->ticks = val;
+	    }
+	  else
+	    ERROR ("invalid argument in '%s' (try '-h')", arg);
+	}
+      else if ((valstr = kissat_parse_option_name (arg, "memory")))
+	{
+	  int val;
+	  if (kissat_parse_option_value (valstr, &val) && val > 0)
+	    {
+	      if (application->memory > 0)
+		ERROR ("multiple '--memory=%d' and '%s'",
+		       application->memory, arg);
+	      kissat_set_memory_limit (solver, (unsigned long) val << 20);
+	      application->memory = val;
+	    }
+	  else
+	    ERROR ("invalid argument in '%s' (try '-h')", arg);
+	}
+#if (!defined(QUIET) || defined(COUNTERS)) && !defined(NOPTIONS)
+      else if ((valstr = kissat_parse_option_name (arg, "trace")))
+	{
+	  if (application->trace_path)
+	    ERROR ("multiple '--trace=%s' and '%s'",
+		   application->trace_path, arg);
+	  if (!*valstr)
+	    ERROR ("invalid argument in '%s' (try '-h')", arg);
+	  if (!kissat_file_writable (valstr))
+	    ERROR ("can not write trace to '%s'", valstr);
+	  application->trace_path = valstr;
+	}
+#endif
       else if (!strcmp (arg, "--partial"))
 	application->partial = true;
 #ifndef NPROOFS
@@ -805,14 +858,17 @@ print_limits (application * application)
 {
   kissat *solver = application->solver;
   const int verbosity = kissat_verbosity (solver);
-  if (verbosity < 1 &&
-      application->conflicts < 0 && application->decisions < 0)
+  if (verbosity < 1 && application->conflicts < 0 &&
+      application->decisions < 0 && application->ticks < 0 &&
+      !application->memory)
     return;
 
   kissat_section (solver, "limits");
-  if (!application->time &&
-      application->conflicts < 0 && application->decisions < 0)
-    kissat_message (solver, "no time, conflict nor decision limit set");
+  if (!application->time && application->conflicts < 0 &&
+      application->decisions < 0 && application->ticks < 0 &&
+      !application->memory)
+    kissat_message (solver,
+		    "no time, conflict, decision, ticks nor memory limit set");
   else
     {
       if (application->time)
@@ -834,11 +890,55 @@ print_limits (application * application)
 			application->decisions);
       else if (verbosity > 0)
 	kissat_message (solver, "no decision limit");
+
+      if (application->ticks >= 0)
+	kissat_message (solver,
+			"ticks limit set to %d ticks", application->ticks);
+      else if (verbosity > 0)
+	kissat_message (solver, "no ticks limit");
+
+      if (application->memory > 0)
+	kissat_message (solver,
+			"memory limit set to %d MB", application->memory);
+      else if (verbosity > 0)
+	kissat_message (solver, "no memory limit");
     }
 }
 
 #endif
 
+#if (!defined(QUIET) || defined(COUNTERS)) && !defined(NOPTIONS)
+
+#define DEFAULT_TRACE_EVENTS 100000
+
+static void
+init_trace (application * application)
+{
+  if (!application->trace_path)
+    return;
+  kissat *solver = application->solver;
+  if (!GET_OPTION (traceevents))
+    kissat_set_option (solver, "traceevents", DEFAULT_TRACE_EVENTS);
+}
+
+static void
+write_trace (application * application)
+{
+  const char *path = application->trace_path;
+  if (!path)
+    return;
+  kissat *solver = application->solver;
+  if (!solver->trace.events)
+    kissat_message (solver, "no events recorded to write to '%s'", path);
+  else if (kissat_write_trace (solver, path))
+    kissat_message (solver, "wrote trace of %" PRIu64
+		    " recorded events to '%s'", solver->trace.recorded, path);
+  else
+    kissat_warning (solver, "failed to write trace to '%s'", path);
+}
+
+#endif
+
 static int
 run_application (kissat * solver,
 		 int argc, char **argv, bool * cancel_alarm_ptr)
@@ -878,6 +978,11 @@ run_application (kissat * solver,
   print_options (solver);
 #endif
   print_limits (&application);
+#endif
+#if (!defined(QUIET) || defined(COUNTERS)) && !defined(NOPTIONS)
+  init_trace (&application);
+#endif
+#ifndef QUIET
   kissat_section (solver, "solving");
 #endif
   int res = kissat_solve (solver);
@@ -902,12 +1007,15 @@ run_application (kissat * solver,
 				  application.max_var, application.partial);
 	}
     }
-#ifndef QUIET
+#if !defined(QUIET) || defined(COUNTERS)
   kissat_print_statistics (solver);
 #endif
 #ifndef NPROOFS
   close_proof (&application);
 #endif
+#if (!defined(QUIET) || defined(COUNTERS)) && !defined(NOPTIONS)
+  write_trace (&application);
+#endif
 #ifndef QUIET
   kissat_section (solver, "shutting down");
   kissat_message (solver, "exit %d", res);
@@ -41,6 +41,7 @@ kissat_allocate_clause (kissat * solver, size_t size)
   if (needed > available)
     {
       const arena before = solver->arena;
+      START_MEMORY (arena);
       do
 	{
 	  assert (kissat_is_zero_or_power_of_two (capacity));
@@ -59,6 +60,7 @@ kissat_allocate_clause (kissat * solver, size_t size)
 	  available = capacity - res;
 	}
       while (needed > available);
+      STOP_MEMORY (arena);
       INC (arena_resized);
       INC (arena_enlarged);
       report_resized (solver, "enlarged", before);
@@ -97,10 +99,20 @@ kissat_shrink_arena (kissat * solver)
     }
   INC (arena_resized);
   INC (arena_shrunken);
+  START_MEMORY (arena);
   SHRINK_STACK (solver->arena);
+  STOP_MEMORY (arena);
   report_resized (solver, "shrunken", before);
 }
 
+void
+kissat_release_arena (kissat * solver)
+{
+  START_MEMORY (arena);
+  RELEASE_STACK (solver->arena);
+  STOP_MEMORY (arena);
+}
+
 #if !defined(NDEBUG) || defined(LOGGING)
 
 bool
@@ -29,6 +29,7 @@ struct kissat;
 
 reference kissat_allocate_clause (struct kissat *, size_t size);
 void kissat_shrink_arena (struct kissat *);
+void kissat_release_arena (struct kissat *);
 
 #if !defined(NDEBUG) || defined(LOGGING)
 
@@ -163,6 +163,10 @@ kissat_backtrack_without_updating_phases (kissat * solver, unsigned new_level)
        (size_t) (new_end - trail));
   solver->propagate = new_end;
 
+  const unsigned propagated = new_end - trail;
+  if (solver->gauss.propagated > propagated)
+    solver->gauss.propagated = propagated;
+
   assert (!solver->extended);
 }
 
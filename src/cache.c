@@ -162,9 +162,11 @@ kissat_insert_cache (kissat * solver, unsigned unsatisfied)
 			   "to limit %u = log2 (%" PRIu64 ")",
 			   size, limit, inserted);
       line line;
+      START_MEMORY (cache);
       line.bits = kissat_new_bits (solver, solver->vars);
       copy_line (solver, &line, unsatisfied, signature, inserted);
       PUSH_STACK (cache->lines, line);
+      STOP_MEMORY (cache);
       kissat_very_verbose (solver, "cached assignment[%" PRIu64 "] "
 			   "with %u unsatisfied clauses",
 			   line.inserted, line.unsatisfied);
@@ -278,13 +280,32 @@ kissat_lookup_cache (kissat * solver)
   return l->bits;
 }
 
+const line *
+kissat_minimum_cache_line (kissat * solver)
+{
+  cache *cache = &solver->cache;
+  if (!cache->valid)
+    return 0;
+  const line *const end = END_STACK (cache->lines);
+  const line *res = 0;
+  for (const line * l = BEGIN_STACK (cache->lines); l != end; l++)
+    if (!res || l->unsatisfied < res->unsatisfied ||
+	(l->unsatisfied == res->unsatisfied && l->inserted > res->inserted))
+      res = l;
+  if (res)
+    LOGLINE (res, "minimum");
+  return res;
+}
+
 void
 kissat_release_cache (kissat * solver)
 {
   LOG ("releasing cache of size %zu", SIZE_STACK (solver->cache.lines));
+  START_MEMORY (cache);
   for (all_stack (line, l, solver->cache.lines))
     release_cache_line (solver, &l);
   RELEASE_STACK (solver->cache.lines);
+  STOP_MEMORY (cache);
   solver->cache.vars = solver->vars;
   solver->cache.valid = true;
 }
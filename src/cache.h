@@ -46,5 +46,6 @@ void kissat_release_cache (struct kissat *);
 bool kissat_insert_cache (struct kissat *, unsigned unsatisfied);
 void kissat_update_cache (struct kissat *, unsigned unsatisfied);
 bits *kissat_lookup_cache (struct kissat *);
+const line *kissat_minimum_cache_line (struct kissat *);
 
 #endif
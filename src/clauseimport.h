@@ -1,3 +1,4 @@
 
 bool kissat_importing_redundant_clauses (kissat * solver);
 void kissat_import_redundant_clauses (kissat * solver);
+void kissat_import_redundant_clause (kissat * solver, int *lits, int size, int glue);
@@ -7,6 +7,7 @@
 #include "inline.h"
 #include "print.h"
 #include "report.h"
+#include "resources.h"
 #include "trail.h"
 #include "sort.c"
 
@@ -279,6 +280,17 @@ update_last_irredundant (kissat * solver, const clause * end,
     }
 }
 
+static unsigned
+redundant_clause_tier (const clause * c, unsigned tier2)
+{
+  assert (c->redundant);
+  if (c->keep)
+    return 1;
+  if (c->glue <= tier2)
+    return 2;
+  return 3;
+}
+
 static void
 move_redundant_clauses_to_the_end (kissat * solver, reference ref)
 {
@@ -325,22 +337,37 @@ move_redundant_clauses_to_the_end (kissat * solver, reference ref)
 	}
       p = (clause *) (bytes + (char *) p);
     }
-  r = redundant;
+  const clause *const end_redundant = r;
   clause *first_reducible = 0;
-  while (q != end)
-    {
-      size_t bytes = kissat_bytes_of_clause (r->size);
-      memcpy (q, r, bytes);
-      LOGCLS (q, "new DST");
-      if (q->reason)
-	get_forced_and_update_large_reason (solver, assigned, values, q);
-      assert (q->redundant);
-      if (!first_reducible && !q->keep)
-	first_reducible = q;
-      r = (clause *) (bytes + (char *) r);
-      q = (clause *) (bytes + (char *) q);
-    }
-  assert ((char *) r <= (char *) redundant + bytes_redundant);
+
+  // Copy back redundant clauses segregated by tier (first kept tier one
+  // clauses, then tier two and finally all other clauses).  This keeps
+  // tier one clauses before 'first_reducible' and thus out of the scan in
+  // 'kissat_reduce' while clauses of the same tier share cache lines.
+
+  const unsigned tier2 = GET_OPTION (tier2);
+  const unsigned tiers = GET_OPTION (tiers) ? 3 : 1;
+
+  for (unsigned tier = 1; tier <= tiers; tier++)
+    for (r = redundant; r != end_redundant;)
+      {
+	size_t bytes = kissat_bytes_of_clause (r->size);
+	if (tiers == 1 || redundant_clause_tier (r, tier2) == tier)
+	  {
+	    memcpy (q, r, bytes);
+	    LOGCLS (q, "new DST");
+	    if (q->reason)
+	      get_forced_and_update_large_reason (solver, assigned,
+						  values, q);
+	    assert (q->redundant);
+	    if (!first_reducible && !q->keep)
+	      first_reducible = q;
+	    q = (clause *) (bytes + (char *) q);
+	  }
+	r = (clause *) (bytes + (char *) r);
+      }
+  assert (q == end);
+  assert ((char *) end_redundant <= (char *) redundant + bytes_redundant);
   kissat_free (solver, redundant, bytes_redundant);
 
   assert (!first_reducible || first_reducible < q);
@@ -382,6 +409,11 @@ sparse_sweep_garbage_clauses (kissat * solver, bool compact, reference start)
   clause *first_reducible = 0;
   clause *last_irredundant;
 
+  const unsigned tier2 = GET_OPTION (tier2);
+  const bool tiers = GET_OPTION (tiers);
+  unsigned max_tier = 0;
+  size_t misplaced_bytes = 0;
+
   if (start)
     last_irredundant = kissat_last_irredundant_clause (solver);
   else
@@ -563,9 +595,19 @@ sparse_sweep_garbage_clauses (kissat * solver, bool compact, reference start)
 	      if (!first_reducible && !dst->keep)
 		first_reducible = dst;
 
-	      redundant_bytes += (char *) next_dst - (char *) dst;
+	      const size_t bytes = (char *) next_dst - (char *) dst;
+	      redundant_bytes += bytes;
 	      if (!first_redundant)
 		first_redundant = dst;
+
+	      if (tiers)
+		{
+		  const unsigned tier = redundant_clause_tier (dst, tier2);
+		  if (tier < max_tier)
+		    misplaced_bytes += bytes;
+		  else
+		    max_tier = tier;
+		}
 	    }
 	  else
 	    last_irredundant = dst;
@@ -631,10 +673,29 @@ sparse_sweep_garbage_clauses (kissat * solver, bool compact, reference start)
   ADD (allocated_collected, bytes);
 #endif
 
+  // Learned clauses following a clause of a higher tier are misplaced.
+  // Segregating them requires to copy all redundant clauses, which is
+  // only worth it if enough of them are misplaced.
+
+  const uint64_t misplaced_limit = GET_OPTION (tiersmisplaced);
+  const bool segregate = misplaced_bytes &&
+    100 * (uint64_t) misplaced_bytes > misplaced_limit * redundant_bytes;
+  if (segregate)
+    {
+      INC (segregated);
+      kissat_phase (solver, "collect", GET (garbage_collections),
+		    "segregating tiers with %s misplaced %.0f%% "
+		    "out of %s redundant",
+		    FORMAT_BYTES (misplaced_bytes),
+		    kissat_percent (misplaced_bytes, redundant_bytes),
+		    FORMAT_BYTES (redundant_bytes));
+    }
+
   reference res = INVALID_REF;
 
   if (first_redundant &&
-      last_irredundant && first_redundant < last_irredundant)
+      ((last_irredundant && first_redundant < last_irredundant) ||
+       segregate))
     {
 #ifdef LOGGING
       size_t move_bytes = (char *) dst - (char *) first_redundant;
@@ -697,10 +758,27 @@ rewatch_clauses (kissat * solver, reference start)
     }
 }
 
+#ifndef QUIET
+
+static void
+update_collect_pause (kissat * solver, double started)
+{
+  const double pause = kissat_process_time () - started;
+  kissat_extremely_verbose (solver, "garbage collection took %.2f seconds",
+			    pause);
+  if (pause > solver->collect_pause)
+    solver->collect_pause = pause;
+}
+
+#endif
+
 void
 kissat_sparse_collect (kissat * solver, bool compact, reference start)
 {
   assert (solver->watching);
+#ifndef QUIET
+  const double started = kissat_process_time ();
+#endif
   START (collect);
   INC (garbage_collections);
   INC (sparse_garbage_collections);
@@ -723,6 +801,9 @@ kissat_sparse_collect (kissat * solver, bool compact, reference start)
   REPORT (1, 'C');
   kissat_check_statistics (solver);
   STOP (collect);
+#ifndef QUIET
+  update_collect_pause (solver, started);
+#endif
 }
 
 static void
@@ -803,6 +884,9 @@ kissat_dense_collect (kissat * solver)
 {
   assert (!solver->watching);
   assert (!solver->level);
+#ifndef QUIET
+  const double started = kissat_process_time ();
+#endif
   START (collect);
   INC (garbage_collections);
   INC (dense_garbage_collections);
@@ -810,4 +894,7 @@ kissat_dense_collect (kissat * solver)
   dense_sweep_garbage_clauses (solver);
   REPORT (1, 'C');
   STOP (collect);
+#ifndef QUIET
+  update_collect_pause (solver, started);
+#endif
 }
@@ -398,6 +398,7 @@ compact_cache (kissat * solver, unsigned new_vars)
        SIZE_STACK (cache->lines), cache->vars);
   const line *const end = END_STACK (cache->lines);
   line *begin = BEGIN_STACK (cache->lines);
+  START_MEMORY (cache);
   for (line * l = begin; l != end; l++)
     {
       assert (l->vars == solver->vars);
@@ -405,6 +406,7 @@ compact_cache (kissat * solver, unsigned new_vars)
       l->bits = compact_bits (solver, l->bits, new_vars);
       l->vars = new_vars;
     }
+  STOP_MEMORY (cache);
   cache->vars = new_vars;
 }
 
@@ -462,6 +464,7 @@ kissat_finalize_compacting (kissat * solver, unsigned vars, unsigned mfixed)
   compact_frames (solver);
   compact_export (solver, vars);
   compact_best_and_target_values (solver, vars);
+  kissat_reset_gauss (solver);
 
   solver->vars = vars;
 #ifdef LOGGING
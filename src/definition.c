@@ -1,5 +1,6 @@
 #include "allocate.h"
 #include "definition.h"
+#include "degrade.h"
 #include "gates.h"
 #include "inline.h"
 #include "kitten.h"
@@ -105,6 +106,8 @@ kissat_find_definition (kissat * solver, unsigned lit)
 {
   if (!GET_OPTION (definitions))
     return false;
+  if (solver->memory.degraded >= DEGRADED_SHRUNKEN)
+    return false;
   START (definition);
   struct kitten *kitten = solver->kitten;
   assert (kitten);
@@ -0,0 +1,110 @@
+#include "cache.h"
+#include "collect.h"
+#include "degrade.h"
+#include "internal.h"
+#include "logging.h"
+#include "print.h"
+#include "reduce.h"
+#include "report.h"
+
+#include <inttypes.h>
+
+static uint64_t
+allocated (kissat * solver)
+{
+  return solver->memory.total + sizeof *solver;
+}
+
+static uint64_t
+soft_memory_limit (kissat * solver)
+{
+  return solver->limits.memory / 100 * GET_OPTION (degradelim);
+}
+
+static bool
+reducing_memory (kissat * solver)
+{
+  if (!GET_OPTION (reduce))
+    return false;
+  if (!solver->statistics.clauses_redundant)
+    return false;
+  return CONFLICTS >= solver->limits.degrade.conflicts;
+}
+
+bool
+kissat_degrading (kissat * solver)
+{
+  if (!solver->limited.memory)
+    return false;
+  if (!GET_OPTION (degrade))
+    return false;
+  if (allocated (solver) < soft_memory_limit (solver))
+    return false;
+  if (reducing_memory (solver))
+    return true;
+  return solver->memory.degraded < DEGRADED_ISOLATED;
+}
+
+static void
+shrink (kissat * solver)
+{
+  INC (memory_shrunken);
+  solver->memory.degraded = DEGRADED_SHRUNKEN;
+  kissat_phase (solver, "degrade", GET (memory_shrunken),
+		"disabling local search, sweeping and cache");
+  kissat_release_cache (solver);
+  kissat_defrag_watches (solver);
+  REPORT (0, 'M');
+}
+
+static void
+isolate (kissat * solver)
+{
+  INC (memory_isolated);
+  solver->memory.degraded = DEGRADED_ISOLATED;
+  kissat_phase (solver, "degrade", GET (memory_isolated),
+		"stop importing clauses");
+  REPORT (0, 'M');
+}
+
+int
+kissat_degrade (kissat * solver)
+{
+  assert (kissat_degrading (solver));
+  kissat_extremely_verbose (solver, "degrading with %" PRIu64
+			    " bytes allocated (soft limit %" PRIu64 ")",
+			    allocated (solver), soft_memory_limit (solver));
+  int res = 0;
+  if (reducing_memory (solver))
+    {
+      res = kissat_reduce_memory (solver);
+      solver->limits.degrade.conflicts = CONFLICTS + GET_OPTION (degradeint);
+      LOG ("next memory reduction at %" PRIu64 " conflicts",
+	   solver->limits.degrade.conflicts);
+    }
+  else if (solver->memory.degraded < DEGRADED_SHRUNKEN)
+    shrink (solver);
+  else
+    {
+      assert (solver->memory.degraded < DEGRADED_ISOLATED);
+      isolate (solver);
+    }
+  return res;
+}
+
+bool
+kissat_memory_limit_hit (kissat * solver)
+{
+  if (!solver->limited.memory)
+    return false;
+  const uint64_t bytes = allocated (solver);
+  if (bytes < solver->limits.memory)
+    return false;
+  if (kissat_degrading (solver))
+    return false;
+  INC (memory_limit_hits);
+  kissat_verbose (solver, "memory limit %" PRIu64 " bytes hit "
+		  "with %" PRIu64 " bytes allocated",
+		  solver->limits.memory, bytes);
+  return true;
+}
@@ -0,0 +1,19 @@
+#ifndef _degrade_h_INCLUDED
+#define _degrade_h_INCLUDED
+
+#include <stdbool.h>
+
+// Steps taken (in this order) if allocated memory exceeds the soft limit
+// given by 'degradelim' percent of the memory limit and early reductions
+// do not help.  They are kept until the solver is released.
+
+#define DEGRADED_SHRUNKEN 1	// no local search, sweeping and cache
+#define DEGRADED_ISOLATED 2	// no more clause imports
+
+struct kissat;
+
+bool kissat_degrading (struct kissat *);
+int kissat_degrade (struct kissat *);
+bool kissat_memory_limit_hit (struct kissat *);
+
+#endif
@@ -2,6 +2,7 @@
 #include "backtrack.h"
 #include "backward.h"
 #include "collect.h"
+#include "degrade.h"
 #include "dense.h"
 #include "eliminate.h"
 #include "forward.h"
@@ -232,8 +233,21 @@ kissat_flush_units_while_connected (kissat * solver)
     }
 }
 
+static bool
+forward_subsume_resolvent (kissat * solver,
+			   uint64_t * checked_ptr, uint64_t * succeeded_ptr)
+{
+  const size_t size = SIZE_STACK (solver->clause);
+  const bool res = kissat_forward_subsume_temporary (solver);
+  *checked_ptr += 1;
+  if (res || SIZE_STACK (solver->clause) < size)
+    *succeeded_ptr += 1;
+  return res;
+}
+
 static void
-connect_resolvents (kissat * solver)
+connect_resolvents (kissat * solver, bool forward,
+		    uint64_t * checked_ptr, uint64_t * succeeded_ptr)
 {
   bool backward = GET_OPTION (backward);
   const value *const values = solver->values;
@@ -246,7 +260,9 @@ connect_resolvents (kissat * solver)
 	{
 	  if (satisfied)
 	    satisfied = false;
-	  else if (kissat_forward_subsume_temporary (solver))
+	  else if (forward &&
+		   forward_subsume_resolvent (solver,
+					      checked_ptr, succeeded_ptr))
 	    LOGTMP ("temporary forward subsumed");
 	  else
 	    {
@@ -456,7 +472,8 @@ can_eliminate_variable (kissat * solver, unsigned idx)
 }
 
 static bool
-eliminate_variable (kissat * solver, unsigned idx)
+eliminate_variable (kissat * solver, unsigned idx, bool forward,
+		    uint64_t * checked_ptr, uint64_t * succeeded_ptr)
 {
   assert (!solver->inconsistent);
   if (!can_eliminate_variable (solver, idx))
@@ -464,7 +481,7 @@ eliminate_variable (kissat * solver, unsigned idx)
   unsigned lit;
   if (!kissat_generate_resolvents (solver, idx, &lit))
     return false;
-  connect_resolvents (solver);
+  connect_resolvents (solver, forward, checked_ptr, succeeded_ptr);
   if (!solver->inconsistent)
     weaken_clauses (solver, lit);
   INC (eliminated);
@@ -501,6 +518,9 @@ eliminate_variables (kissat * solver)
   int round = 0;
 
   const bool forward = GET_OPTION (forward);
+  const uint64_t forwardtmp = GET_OPTION (forwardtmp);
+  uint64_t forward_checked = 0, forward_succeeded = 0;
+  bool forward_resolvents = forward;
 
   for (;;)
     {
@@ -566,7 +586,18 @@ eliminate_variables (kissat * solver)
 	      tried++;
 	      if (eliminateheap)
 		idx = kissat_pop_max_heap (solver, &solver->schedule);
-	      if (eliminate_variable (solver, idx))
+	      if (forward_resolvents && forwardtmp &&
+		  forward_checked > forwardtmp * (forward_succeeded + 1))
+		{
+		  kissat_extremely_verbose (solver,
+					    "stop forward subsuming resolvents "
+					    "after %" PRIu64 " checks with %"
+					    PRIu64 " successful",
+					    forward_checked, forward_succeeded);
+		  forward_resolvents = false;
+		}
+	      if (eliminate_variable (solver, idx, forward_resolvents,
+				      &forward_checked, &forward_succeeded))
 		eliminated++, last_round_eliminated++;
 	      if (!solver->inconsistent)
 		kissat_flush_units_while_connected (solver);
@@ -681,6 +712,8 @@ init_map_and_kitten (kissat * solver)
 {
   if (!GET_OPTION (definitions))
     return;
+  if (solver->memory.degraded >= DEGRADED_SHRUNKEN)
+    return;
   assert (!solver->kitten);
   solver->kitten = kitten_embedded (solver);
 }
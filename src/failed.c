@@ -222,6 +222,13 @@ probe_round (kissat * solver, unsigned round,
 #ifndef QUIET
   const unsigned scheduled = SIZE_STACK (*probes);
 #endif
+  // Literals implied by a probe which did not fail are stamped with one
+  // plus the number of failed literals found so far.  Probing them later
+  // is redundant as long as no further literal failed, since then they
+  // would imply a subset of what the original probe implied.  Adding one
+  // keeps the zero initialized stamps from matching before the first
+  // failed literal is found.
+
   unsigned *stamps = kissat_calloc (solver, LITS, sizeof *stamps);
   const value *const values = solver->values;
   flags *flags = solver->flags;
@@ -254,7 +261,7 @@ probe_round (kissat * solver, unsigned round,
 	continue;
       const unsigned probe_idx = IDX (probe);
       flags[probe_idx].probe = false;
-      if (failed && stamps[probe] == failed)
+      if (stamps[probe] == failed + 1)
 	continue;
       if (solver->stable)
 	LOG ("probing %s[%g]", LOGLIT (probe),
@@ -285,7 +292,7 @@ probe_round (kissat * solver, unsigned round,
 	  assert (kissat_propagated (solver));
 	  const unsigned *const propagated = solver->propagate;
 	  while (saved != propagated)
-	    stamps[*saved++] = failed;
+	    stamps[*saved++] = failed + 1;
 	  kissat_backtrack_without_updating_phases (solver, 0);
 	}
 
@@ -349,6 +349,15 @@ forward_marked_clause (kissat * solver, clause * c, unsigned *remove)
 
       if (forward_literal (solver, lit, true, remove))
 	return true;
+
+      // Large clauses are only connected to literals of variables with
+      // the 'subsume' flag set, which can only be set but not reset
+      // while checking candidates.  Thus without the flag the negated
+      // occurrence list contains only binary clauses, which are ignored.
+
+      if (!flags[idx].subsume)
+	continue;
+
       if (forward_literal (solver, NOT (lit), false, remove))
 	return true;
     }
@@ -0,0 +1,962 @@
+#include "allocate.h"
+#include "gauss.h"
+#include "inline.h"
+#include "print.h"
+#include "propsearch.h"
+#include "sort.h"
+
+#include <inttypes.h>
+#include <string.h>
+
+#define INVALID_COLUMN UINT_MAX
+#define INVALID_ROW UINT_MAX
+
+#define MAX_GAUSS_CLAUSE_SIZE 8
+
+#define ROW(R) (gauss->matrix + (size_t) (R) * gauss->words)
+#define BIT(C) ((uint64_t) 1 << ((C) & 63))
+#define GET_BIT(ROW,C) (((ROW)[(C) >> 6] & BIT (C)) != 0)
+
+#define all_columns_in_row(COL,ROW,WORDS) \
+  uint64_t COL##_word = 0, COL##_bits = 0, COL; \
+  next_column (&COL, &COL##_word, &COL##_bits, (ROW), (WORDS));
+
+static inline bool
+next_column (uint64_t * col_ptr, uint64_t * word_ptr, uint64_t * bits_ptr,
+	     const uint64_t * row, unsigned words)
+{
+  uint64_t bits = *bits_ptr;
+  while (!bits)
+    {
+      if (*word_ptr == words)
+	return false;
+      bits = row[(*word_ptr)++];
+    }
+  *col_ptr = 64 * (*word_ptr - 1) + __builtin_ctzll (bits);
+  *bits_ptr = bits & (bits - 1);
+  return true;
+}
+
+void
+kissat_init_gauss (kissat * solver)
+{
+  if (!GET_OPTION (gauss))
+    return;
+#ifndef NPROOFS
+  if (solver->proof)
+    return;
+#endif
+  gauss *gauss = &solver->gauss;
+  gauss->enabled = gauss->dirty = true;
+}
+
+static void
+release_matrix (kissat * solver)
+{
+  gauss *gauss = &solver->gauss;
+  DEALLOC (gauss->matrix, (size_t) gauss->rows * gauss->words);
+  DEALLOC (gauss->rhs, gauss->rows);
+  DEALLOC (gauss->queued, gauss->rows);
+  DEALLOC (gauss->basic, gauss->rows);
+  DEALLOC (gauss->watch, gauss->rows);
+  if (gauss->watches)
+    for (unsigned col = 0; col < gauss->columns; col++)
+      RELEASE_STACK (gauss->watches[col]);
+  DEALLOC (gauss->watches, gauss->columns);
+  DEALLOC (gauss->pivot, gauss->columns);
+  DEALLOC (gauss->vars, gauss->columns);
+  DEALLOC (gauss->column, gauss->size);
+  gauss->matrix = 0;
+  gauss->rhs = gauss->queued = 0;
+  gauss->basic = gauss->watch = 0;
+  gauss->pivot = gauss->vars = gauss->column = 0;
+  gauss->watches = 0;
+  gauss->rows = gauss->columns = gauss->words = gauss->size = 0;
+  CLEAR_STACK (gauss->check);
+}
+
+void
+kissat_reset_gauss (kissat * solver)
+{
+  gauss *gauss = &solver->gauss;
+  if (!gauss->enabled)
+    return;
+  release_matrix (solver);
+  gauss->dirty = true;
+}
+
+void
+kissat_release_gauss (kissat * solver)
+{
+  gauss *gauss = &solver->gauss;
+  release_matrix (solver);
+  RELEASE_STACK (gauss->xors);
+  RELEASE_STACK (gauss->check);
+}
+
+bool
+kissat_gaussing (kissat * solver)
+{
+  const gauss *const gauss = &solver->gauss;
+  if (gauss->dirty)
+    return !solver->level;
+  if (!gauss->rows)
+    return false;
+  return gauss->rescan || gauss->propagated < SIZE_ARRAY (solver->trail);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Extraction of XOR constraints from their direct CNF encoding, i.e., all
+// 2^(n-1) clauses over the same 'n' variables with an even or all with an
+// odd number of negated literals.  Candidate clauses are collected as
+// records of size, sorted variables and the bit-mask of negated literals,
+// which after sorting puts clauses over the same variables next to each
+// other.
+
+static inline bool
+less_candidate (const unsigned *candidates, unsigned a, unsigned b)
+{
+  const unsigned *c = candidates + a, *d = candidates + b;
+  const unsigned size = c[0];
+  if (size != d[0])
+    return size < d[0];
+  for (unsigned i = 1; i <= size + 1; i++)
+    if (c[i] != d[i])
+      return c[i] < d[i];
+  return false;
+}
+
+static bool
+same_variables (const unsigned *c, const unsigned *d)
+{
+  const unsigned size = c[0];
+  if (size != d[0])
+    return false;
+  for (unsigned i = 1; i <= size; i++)
+    if (c[i] != d[i])
+      return false;
+  return true;
+}
+
+static void
+push_xor (kissat * solver, unsigned size, const unsigned *idxs, bool rhs)
+{
+  ints *xors = &solver->gauss.xors;
+  PUSH_STACK (*xors, (int) size);
+  const size_t offset = SIZE_STACK (*xors);
+  PUSH_STACK (*xors, 0);
+  for (unsigned i = 0; i < size; i++)
+    {
+      int elit = kissat_export_literal (solver, LIT (idxs[i]));
+      assert (elit);
+      if (elit < 0)
+	elit = -elit, rhs = !rhs;
+      PUSH_STACK (*xors, elit);
+    }
+  POKE_STACK (*xors, offset, rhs);
+  int *evars = END_STACK (*xors) - size;
+#define LESS_VARIABLE(A,B) ((A) < (B))
+  SORT (int, size, evars, LESS_VARIABLE);
+}
+
+static void
+collect_candidates (kissat * solver, unsigneds * candidates,
+		    unsigneds * offsets)
+{
+  const unsigned limit = GET_OPTION (gaussclslim);
+  assert (limit <= MAX_GAUSS_CLAUSE_SIZE);
+  const value *const values = solver->values;
+  const flags *const all_flags = solver->flags;
+  unsigned lits[MAX_GAUSS_CLAUSE_SIZE];
+  for (all_clauses (c))
+    {
+      if (c->garbage || c->redundant)
+	continue;
+      const unsigned size = c->size;
+      if (size > limit)
+	continue;
+      bool skip = false;
+      unsigned n = 0;
+      for (all_literals_in_clause (lit, c))
+	{
+	  if (values[lit] || !all_flags[IDX (lit)].active)
+	    {
+	      skip = true;
+	      break;
+	    }
+	  lits[n++] = lit;
+	}
+      if (skip)
+	continue;
+      assert (n == size);
+      for (unsigned i = 1; i < size; i++)
+	{
+	  const unsigned lit = lits[i];
+	  unsigned j = i;
+	  while (j && lits[j - 1] > lit)
+	    lits[j] = lits[j - 1], j--;
+	  lits[j] = lit;
+	}
+      unsigned mask = 0;
+      PUSH_STACK (*offsets, SIZE_STACK (*candidates));
+      PUSH_STACK (*candidates, size);
+      for (unsigned i = 0; i < size; i++)
+	{
+	  const unsigned lit = lits[i];
+	  PUSH_STACK (*candidates, IDX (lit));
+	  if (NEGATED (lit))
+	    mask |= 1u << i;
+	}
+      PUSH_STACK (*candidates, mask);
+    }
+}
+
+static unsigned
+extract_xors (kissat * solver)
+{
+  unsigneds candidates, offsets;
+  INIT_STACK (candidates);
+  INIT_STACK (offsets);
+  collect_candidates (solver, &candidates, &offsets);
+  const unsigned *const begin = BEGIN_STACK (candidates);
+#define LESS_CANDIDATE(A,B) less_candidate (begin, (A), (B))
+  SORT_STACK (unsigned, offsets, LESS_CANDIDATE);
+  unsigned extracted = 0;
+  const unsigned *const end = END_STACK (offsets);
+  const unsigned *p = BEGIN_STACK (offsets);
+  while (p != end)
+    {
+      const unsigned *c = begin + *p;
+      const unsigned size = c[0];
+      unsigned count[2] = { 0, 0 };
+      unsigned last = UINT_MAX;
+      const unsigned *q = p;
+      while (q != end && same_variables (c, begin + *q))
+	{
+	  const unsigned mask = begin[*q + size + 1];
+	  if (mask != last)
+	    count[__builtin_popcount (mask) & 1]++, last = mask;
+	  q++;
+	}
+      const unsigned needed = 1u << (size - 1);
+      for (unsigned parity = 0; parity < 2; parity++)
+	if (count[parity] == needed)
+	  {
+	    push_xor (solver, size, c + 1, !parity);
+	    extracted++;
+	  }
+      p = q;
+    }
+  RELEASE_STACK (candidates);
+  RELEASE_STACK (offsets);
+  ADD (gauss_extracted, extracted);
+  return extracted;
+}
+
+/*------------------------------------------------------------------------*/
+
+// XOR constraints are stored over external variables.  Those mentioning
+// variables which have been eliminated (or are otherwise not imported
+// anymore) are dropped before new ones are extracted.
+
+static bool
+valid_xor (kissat * solver, const int *evars, unsigned size)
+{
+  for (unsigned i = 0; i < size; i++)
+    {
+      const unsigned eidx = evars[i];
+      if (eidx >= SIZE_STACK (solver->import))
+	return false;
+      const import *const import = &PEEK_STACK (solver->import, eidx);
+      if (!import->imported || import->eliminated)
+	return false;
+    }
+  return true;
+}
+
+static inline bool
+less_xor (const int *xors, unsigned a, unsigned b)
+{
+  const int *c = xors + a, *d = xors + b;
+  const int size = c[0];
+  if (size != d[0])
+    return size < d[0];
+  for (int i = 2; i < size + 2; i++)
+    if (c[i] != d[i])
+      return c[i] < d[i];
+  return c[1] < d[1];
+}
+
+static bool
+same_xor (const int *c, const int *d)
+{
+  const int size = c[0];
+  if (size != d[0])
+    return false;
+  for (int i = 1; i < size + 2; i++)
+    if (c[i] != d[i])
+      return false;
+  return true;
+}
+
+static unsigned
+update_xors (kissat * solver)
+{
+  ints *xors = &solver->gauss.xors;
+  int *q = BEGIN_STACK (*xors);
+  const int *p = q;
+  const int *end = END_STACK (*xors);
+  while (p != end)
+    {
+      const int size = p[0];
+      if (valid_xor (solver, p + 2, size))
+	for (int i = 0; i < size + 2; i++)
+	  *q++ = p[i];
+      p += size + 2;
+    }
+  SET_END_OF_STACK (*xors, q);
+  extract_xors (solver);
+  unsigneds offsets;
+  INIT_STACK (offsets);
+  p = BEGIN_STACK (*xors);
+  end = END_STACK (*xors);
+  for (const int *r = p; r != end; r += r[0] + 2)
+    PUSH_STACK (offsets, r - p);
+  const int *const begin = p;
+#define LESS_XOR(A,B) less_xor (begin, (A), (B))
+  SORT_STACK (unsigned, offsets, LESS_XOR);
+  ints unique;
+  INIT_STACK (unique);
+  const int *last = 0;
+  unsigned count = 0;
+  for (all_stack (unsigned, offset, offsets))
+    {
+      const int *c = begin + offset;
+      if (last && same_xor (last, c))
+	continue;
+      for (int i = 0; i < c[0] + 2; i++)
+	PUSH_STACK (unique, c[i]);
+      last = c;
+      count++;
+    }
+  RELEASE_STACK (offsets);
+  RELEASE_STACK (*xors);
+  *xors = unique;
+  return count;
+}
+
+/*------------------------------------------------------------------------*/
+
+static void
+xor_rows (gauss * gauss, unsigned dst, unsigned src)
+{
+  uint64_t *d = ROW (dst);
+  const uint64_t *s = ROW (src);
+  for (unsigned w = 0; w < gauss->words; w++)
+    d[w] ^= s[w];
+  gauss->rhs[dst] ^= gauss->rhs[src];
+}
+
+static void
+enqueue_row (kissat * solver, unsigned row)
+{
+  gauss *gauss = &solver->gauss;
+  if (gauss->queued[row])
+    return;
+  gauss->queued[row] = true;
+  PUSH_STACK (gauss->check, row);
+}
+
+// Map the XOR constraints to rows over columns of internal variables,
+// folding root-level assigned variables into the right-hand side, and
+// eliminate them into reduced row echelon form.  Pivots are preferably
+// unassigned and empty rows are dropped, unless their right-hand side is
+// true, which makes the formula inconsistent.
+
+static bool
+map_xors (kissat * solver, unsigneds * mapped, unsigneds * vars)
+{
+  gauss *gauss = &solver->gauss;
+  const unsigned limit = GET_OPTION (gaussvarslim);
+  const value *const values = solver->values;
+  unsigned *column = gauss->column;
+  const int *p = BEGIN_STACK (gauss->xors);
+  const int *const end = END_STACK (gauss->xors);
+  unsigned rows = 0;
+  while (p != end)
+    {
+      const int size = p[0];
+      bool rhs = p[1];
+      const int *evars = p + 2;
+      p += size + 2;
+      unsigned fresh = 0;
+      const size_t start = SIZE_STACK (*mapped);
+      PUSH_STACK (*mapped, 0);
+      for (int i = 0; i < size; i++)
+	{
+	  const unsigned eidx = evars[i];
+	  const import *const import = &PEEK_STACK (solver->import, eidx);
+	  assert (import->imported);
+	  assert (!import->eliminated);
+	  const unsigned ilit = import->lit;
+	  if (NEGATED (ilit))
+	    rhs = !rhs;
+	  const unsigned idx = IDX (ilit);
+	  const value value = values[LIT (idx)];
+	  if (value)
+	    {
+	      if (value > 0)
+		rhs = !rhs;
+	      continue;
+	    }
+	  if (column[idx] == INVALID_COLUMN)
+	    fresh++;
+	  PUSH_STACK (*mapped, idx);
+	}
+      const unsigned mapped_size = SIZE_STACK (*mapped) - start - 1;
+      if (!mapped_size)
+	{
+	  RESIZE_STACK (*mapped, start);
+	  if (!rhs)
+	    continue;
+	  LOG ("inconsistent XOR constraint with all variables fixed");
+	  return false;
+	}
+      if (rows == limit || SIZE_STACK (*vars) + fresh > limit)
+	{
+	  RESIZE_STACK (*mapped, start);
+	  continue;
+	}
+      POKE_STACK (*mapped, start, 2 * mapped_size + rhs);
+      for (unsigned i = start + 1; i < SIZE_STACK (*mapped); i++)
+	{
+	  const unsigned idx = PEEK_STACK (*mapped, i);
+	  if (column[idx] == INVALID_COLUMN)
+	    {
+	      column[idx] = SIZE_STACK (*vars);
+	      PUSH_STACK (*vars, idx);
+	    }
+	  POKE_STACK (*mapped, i, column[idx]);
+	}
+      rows++;
+    }
+  return true;
+}
+
+static clause *
+inconsistent_matrix (kissat * solver)
+{
+  LOG ("Gauss-Jordan elimination yields empty clause");
+  ADD_UNCHECKED_INTERNAL (0, 0);
+  return &solver->conflict;
+}
+
+static clause *
+eliminate_matrix (kissat * solver, unsigneds * mapped, unsigneds * vars)
+{
+  gauss *gauss = &solver->gauss;
+  const value *const values = solver->values;
+  const unsigned columns = SIZE_STACK (*vars);
+  const unsigned words = (columns + 63) / 64;
+  unsigned rows = 0;
+  for (const unsigned *p = BEGIN_STACK (*mapped), *end = END_STACK (*mapped);
+       p != end; p += 1 + p[0] / 2)
+    rows++;
+  if (!rows)
+    return 0;
+  uint64_t *matrix;
+  bool *rhs;
+  unsigned *basic;
+  CALLOC (matrix, (size_t) rows * words);
+  CALLOC (rhs, rows);
+  NALLOC (basic, rows);
+  unsigned row = 0;
+  for (const unsigned *p = BEGIN_STACK (*mapped), *end = END_STACK (*mapped);
+       p != end; p += 1 + p[0] / 2, row++)
+    {
+      uint64_t *r = matrix + (size_t) row * words;
+      rhs[row] = p[0] & 1;
+      for (unsigned i = 1; i <= p[0] / 2; i++)
+	r[p[i] >> 6] ^= BIT (p[i]);
+    }
+  clause *res = 0;
+  unsigned kept = 0;
+  for (row = 0; !res && row < rows; row++)
+    {
+      const uint64_t *r = matrix + (size_t) row * words;
+      unsigned pivot = INVALID_COLUMN, fallback = INVALID_COLUMN;
+      for (all_columns_in_row (col, r, words))
+	{
+	  if (!values[LIT (PEEK_STACK (*vars, col))])
+	    {
+	      pivot = col;
+	      break;
+	    }
+	  if (fallback == INVALID_COLUMN)
+	    fallback = col;
+	}
+      if (pivot == INVALID_COLUMN)
+	pivot = fallback;
+      basic[row] = pivot;
+      if (pivot == INVALID_COLUMN)
+	{
+	  if (rhs[row])
+	    res = inconsistent_matrix (solver);
+	  continue;
+	}
+      kept++;
+      const unsigned word = pivot >> 6;
+      const uint64_t bit = BIT (pivot);
+      for (unsigned other = 0; other < rows; other++)
+	{
+	  uint64_t *o = matrix + (size_t) other * words;
+	  if (other == row || !(o[word] & bit))
+	    continue;
+	  for (unsigned w = 0; w < words; w++)
+	    o[w] ^= r[w];
+	  rhs[other] ^= rhs[row];
+	}
+    }
+  if (!res && kept)
+    {
+      gauss->rows = kept;
+      gauss->columns = columns;
+      gauss->words = words;
+      NALLOC (gauss->matrix, (size_t) kept * words);
+      NALLOC (gauss->rhs, kept);
+      CALLOC (gauss->queued, kept);
+      NALLOC (gauss->basic, kept);
+      NALLOC (gauss->watch, kept);
+      CALLOC (gauss->watches, columns);
+      NALLOC (gauss->pivot, columns);
+      NALLOC (gauss->vars, columns);
+      for (unsigned col = 0; col < columns; col++)
+	{
+	  gauss->pivot[col] = INVALID_ROW;
+	  gauss->vars[col] = PEEK_STACK (*vars, col);
+	}
+      unsigned dst = 0;
+      for (unsigned src = 0; src < rows; src++)
+	{
+	  const unsigned pivot = basic[src];
+	  if (pivot == INVALID_COLUMN)
+	    continue;
+	  memcpy (ROW (dst), matrix + (size_t) src * words,
+		  words * sizeof *matrix);
+	  gauss->rhs[dst] = rhs[src];
+	  gauss->basic[dst] = pivot;
+	  gauss->watch[dst] = INVALID_COLUMN;
+	  gauss->pivot[pivot] = dst;
+	  dst++;
+	}
+      assert (dst == kept);
+    }
+  DEALLOC (matrix, (size_t) rows * words);
+  DEALLOC (rhs, rows);
+  DEALLOC (basic, rows);
+  return res;
+}
+
+static clause *
+rebuild_matrix (kissat * solver)
+{
+  gauss *gauss = &solver->gauss;
+  assert (!solver->level);
+  assert (gauss->dirty);
+  release_matrix (solver);
+  const unsigned xors = update_xors (solver);
+  gauss->dirty = false;
+  if (!xors)
+    {
+      if (!GET (gauss_rebuilds))
+	{
+	  kissat_very_verbose (solver,
+			       "no XOR constraints found "
+			       "thus disabling Gauss-Jordan elimination");
+	  gauss->enabled = false;
+	}
+      return 0;
+    }
+  INC (gauss_rebuilds);
+  gauss->size = VARS;
+  NALLOC (gauss->column, gauss->size);
+  for (unsigned idx = 0; idx < gauss->size; idx++)
+    gauss->column[idx] = INVALID_COLUMN;
+  unsigneds mapped, vars;
+  INIT_STACK (mapped);
+  INIT_STACK (vars);
+  clause *res;
+  if (map_xors (solver, &mapped, &vars))
+    res = eliminate_matrix (solver, &mapped, &vars);
+  else
+    res = inconsistent_matrix (solver);
+  RELEASE_STACK (mapped);
+  RELEASE_STACK (vars);
+  gauss->rescan = true;
+  gauss->propagated = SIZE_ARRAY (solver->trail);
+  kissat_phase (solver, "gauss", GET (gauss_rebuilds),
+		"matrix of %u rows and %u columns from %u XOR constraints",
+		gauss->rows, gauss->columns, xors);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Makes the given column the new basic column of the row by eliminating
+// it from all other rows, which then have to be checked again.
+
+static void
+pivot_row (kissat * solver, unsigned row, unsigned new_basic)
+{
+  gauss *gauss = &solver->gauss;
+  const unsigned old_basic = gauss->basic[row];
+  assert (old_basic != new_basic);
+  assert (gauss->pivot[old_basic] == row);
+  gauss->pivot[old_basic] = INVALID_ROW;
+  assert (gauss->pivot[new_basic] == INVALID_ROW);
+  gauss->pivot[new_basic] = row;
+  gauss->basic[row] = new_basic;
+  const unsigned word = new_basic >> 6;
+  const uint64_t bit = BIT (new_basic);
+  for (unsigned other = 0; other < gauss->rows; other++)
+    {
+      if (other == row || !(ROW (other)[word] & bit))
+	continue;
+      xor_rows (gauss, other, row);
+      enqueue_row (solver, other);
+      solver->ticks++;
+    }
+  solver->ticks += 1 + gauss->rows / 8;
+}
+
+// Only rows in which the assigned variable is basic or watched need to be
+// checked.  Watches of those rows are reset and set again while checking.
+
+static void
+process_variable (kissat * solver, unsigned idx)
+{
+  gauss *gauss = &solver->gauss;
+  if (idx >= gauss->size)
+    return;
+  const unsigned col = gauss->column[idx];
+  if (col == INVALID_COLUMN)
+    return;
+  const unsigned row = gauss->pivot[col];
+  if (row != INVALID_ROW)
+    enqueue_row (solver, row);
+  unsigneds *watches = gauss->watches + col;
+  for (all_stack (unsigned, other, *watches))
+    if (gauss->watch[other] == col)
+      {
+	gauss->watch[other] = INVALID_COLUMN;
+	enqueue_row (solver, other);
+      }
+  solver->ticks += 1 + SIZE_STACK (*watches) / 8;
+  CLEAR_STACK (*watches);
+}
+
+static void
+watch_column (kissat * solver, unsigned row, unsigned col)
+{
+  gauss *gauss = &solver->gauss;
+  if (gauss->watch[row] == col)
+    return;
+  gauss->watch[row] = col;
+  if (col != INVALID_COLUMN)
+    PUSH_STACK (gauss->watches[col], row);
+}
+
+// Reasons and conflicts are added as redundant clauses consisting of the
+// falsified literals of the row, skipping root-level falsified literals
+// (for conflicts unless needed to make the clause non-unit).  The checker
+// is told about them as unchecked clauses, since they are in general not
+// implied by unit propagation.
+
+static void
+collect_falsified (kissat * solver, unsigned row, unsigned except,
+		   bool root)
+{
+  gauss *gauss = &solver->gauss;
+  const value *const values = solver->values;
+  const assigned *const assigned = solver->assigned;
+  const uint64_t *r = ROW (row);
+  for (all_columns_in_row (col, r, gauss->words))
+    {
+      const unsigned idx = gauss->vars[col];
+      if (idx == except)
+	continue;
+      if (!root && !assigned[idx].level)
+	continue;
+      const unsigned lit = LIT (idx);
+      const value value = values[lit];
+      assert (value);
+      PUSH_STACK (solver->clause, value > 0 ? NOT (lit) : lit);
+    }
+}
+
+static void
+move_highest_level_to_front (kissat * solver, unsigned *lits,
+			     unsigned size, unsigned pos)
+{
+  const assigned *const assigned = solver->assigned;
+  for (unsigned i = pos + 1; i < size; i++)
+    if (assigned[IDX (lits[i])].level > assigned[IDX (lits[pos])].level)
+      SWAP (unsigned, lits[i], lits[pos]);
+}
+
+static void
+propagate_row (kissat * solver, unsigned row, unsigned lit)
+{
+  unsigneds *stack = &solver->clause;
+  assert (EMPTY_STACK (*stack));
+  PUSH_STACK (*stack, lit);
+  collect_falsified (solver, row, IDX (lit), false);
+  unsigned *lits = BEGIN_STACK (*stack);
+  const unsigned size = SIZE_STACK (*stack);
+  LOGLITS (size, lits, "Gauss-Jordan reason");
+  ADD_UNCHECKED_INTERNAL (size, lits);
+  INC (gauss_propagations);
+  if (size == 1)
+    kissat_learned_unit (solver, lit);
+  else if (size == 2)
+    {
+      kissat_new_redundant_clause (solver, 1);
+      kissat_assign_binary (solver, true, lit, lits[1]);
+    }
+  else
+    {
+      move_highest_level_to_front (solver, lits, size, 1);
+      const reference ref = kissat_new_redundant_clause (solver, size - 1);
+      clause *reason = kissat_dereference_clause (solver, ref);
+      kissat_assign_reference (solver, lit, ref, reason);
+    }
+  CLEAR_STACK (*stack);
+}
+
+static clause *
+conflicting_row (kissat * solver, unsigned row)
+{
+  unsigneds *stack = &solver->clause;
+  assert (EMPTY_STACK (*stack));
+  collect_falsified (solver, row, INVALID_IDX, false);
+  if (SIZE_STACK (*stack) < 2)
+    {
+      CLEAR_STACK (*stack);
+      collect_falsified (solver, row, INVALID_IDX, true);
+    }
+  unsigned *lits = BEGIN_STACK (*stack);
+  const unsigned size = SIZE_STACK (*stack);
+  LOGLITS (size, lits, "Gauss-Jordan conflict");
+  ADD_UNCHECKED_INTERNAL (size, lits);
+  INC (gauss_conflicts);
+  clause *res;
+  if (!solver->level)
+    res = &solver->conflict;
+  else
+    {
+      assert (size > 1);
+      move_highest_level_to_front (solver, lits, size, 0);
+      move_highest_level_to_front (solver, lits, size, 1);
+      const reference ref = kissat_new_redundant_clause (solver, size - 1);
+      if (size == 2)
+	res = kissat_binary_conflict (solver, true, lits[0], lits[1]);
+      else
+	res = kissat_dereference_clause (solver, ref);
+    }
+  CLEAR_STACK (*stack);
+  return res;
+}
+
+// Finds an unassigned non-basic column of the row to be watched.  If there
+// is none the assigned non-basic column of highest level is returned (in
+// 'highest') and 'parity' is set to the parity of the right-hand side and
+// all assigned non-basic variables.  Watching the highest level column
+// makes sure that backtracking unassigns the watched or the basic variable
+// of a fully assigned row before any other of its variables.
+
+static unsigned
+find_watch (kissat * solver, unsigned row, unsigned *highest, bool *parity)
+{
+  gauss *gauss = &solver->gauss;
+  const value *const values = solver->values;
+  const assigned *const assigned = solver->assigned;
+  const unsigned *const vars = gauss->vars;
+  const unsigned basic = gauss->basic[row];
+  const uint64_t *r = ROW (row);
+  bool res = gauss->rhs[row];
+  unsigned highest_column = INVALID_COLUMN, highest_level = 0;
+  solver->ticks++;
+  for (all_columns_in_row (col, r, gauss->words))
+    {
+      if (col == basic)
+	continue;
+      const unsigned idx = vars[col];
+      const value value = values[LIT (idx)];
+      if (!value)
+	return col;
+      if (value > 0)
+	res = !res;
+      const unsigned level = assigned[idx].level;
+      if (highest_column == INVALID_COLUMN || level > highest_level)
+	highest_column = col, highest_level = level;
+    }
+  *highest = highest_column;
+  *parity = res;
+  return INVALID_COLUMN;
+}
+
+// Checks a row after its basic or watched variable has been assigned or
+// after the row has been modified by pivoting.  An assigned basic variable
+// is replaced by an unassigned one if possible.  Then the row either has
+// another unassigned variable to watch, or it propagates its basic
+// variable, is satisfied or conflicting.
+
+static clause *
+check_row (kissat * solver, unsigned row)
+{
+  gauss *gauss = &solver->gauss;
+  const value *const values = solver->values;
+  const unsigned *const vars = gauss->vars;
+  const uint64_t *r = ROW (row);
+  unsigned basic = gauss->basic[row];
+  if (values[LIT (vars[basic])])
+    {
+      for (all_columns_in_row (col, r, gauss->words))
+	if (!values[LIT (vars[col])])
+	  {
+	    pivot_row (solver, row, col);
+	    basic = col;
+	    break;
+	  }
+    }
+  else
+    {
+      const unsigned watch = gauss->watch[row];
+      if (watch != INVALID_COLUMN && watch != basic &&
+	  GET_BIT (r, watch) && !values[LIT (vars[watch])])
+	return 0;
+    }
+  unsigned highest;
+  bool parity;
+  const unsigned watch = find_watch (solver, row, &highest, &parity);
+  if (watch != INVALID_COLUMN)
+    {
+      watch_column (solver, row, watch);
+      return 0;
+    }
+  watch_column (solver, row, highest);
+  const unsigned idx = vars[basic];
+  const value value = values[LIT (idx)];
+  if (!value)
+    {
+      if (FLAGS (idx)->active)
+	{
+	  const unsigned lit = LIT (idx);
+	  propagate_row (solver, row, parity ? lit : NOT (lit));
+	}
+      return 0;
+    }
+  if (value > 0)
+    parity = !parity;
+  return parity ? conflicting_row (solver, row) : 0;
+}
+
+// After a conflict the remaining queued rows are not checked anymore but
+// still need a watch if it has been reset.
+
+static void
+rewatch_row (kissat * solver, unsigned row)
+{
+  gauss *gauss = &solver->gauss;
+  if (gauss->watch[row] != INVALID_COLUMN)
+    return;
+  unsigned highest;
+  bool parity;
+  unsigned watch = find_watch (solver, row, &highest, &parity);
+  if (watch == INVALID_COLUMN)
+    watch = highest;
+  watch_column (solver, row, watch);
+}
+
+static clause *
+check_queued_rows (kissat * solver)
+{
+  gauss *gauss = &solver->gauss;
+  clause *res = 0;
+  for (size_t i = 0; i < SIZE_STACK (gauss->check); i++)
+    {
+      const unsigned row = PEEK_STACK (gauss->check, i);
+      assert (gauss->queued[row]);
+      gauss->queued[row] = false;
+      if (res)
+	rewatch_row (solver, row);
+      else
+	res = check_row (solver, row);
+    }
+  CLEAR_STACK (gauss->check);
+  return res;
+}
+
+static clause *
+gauss_propagate (kissat * solver)
+{
+  gauss *gauss = &solver->gauss;
+  clause *res = 0;
+  if (gauss->dirty)
+    res = rebuild_matrix (solver);
+  if (!res && gauss->rescan)
+    {
+      gauss->rescan = false;
+      for (unsigned row = 0; row < gauss->rows; row++)
+	enqueue_row (solver, row);
+      res = check_queued_rows (solver);
+    }
+  while (!res && gauss->propagated < SIZE_ARRAY (solver->trail))
+    {
+      const unsigned lit = PEEK_ARRAY (solver->trail, gauss->propagated);
+      gauss->propagated++;
+      process_variable (solver, IDX (lit));
+      res = check_queued_rows (solver);
+    }
+  return res;
+}
+
+// Alternates between Gauss-Jordan propagation and unit propagation until
+// completion or a conflict is found.  Conflicts of unit propagation are
+// accounted for by 'kissat_search_propagate' and those found here update
+// the conflict statistics in the same way.
+
+clause *
+kissat_gauss_propagate (kissat * solver)
+{
+  assert (!solver->inconsistent);
+  clause *res = 0;
+  while (!res && kissat_gaussing (solver))
+    {
+      START (gauss);
+      solver->ticks = 0;
+      res = gauss_propagate (solver);
+      ADD (ticks, solver->ticks);
+      ADD (search_ticks, solver->ticks);
+      if (solver->stable)
+	ADD (stable_ticks, solver->ticks);
+      else
+	ADD (focused_ticks, solver->ticks);
+      if (res)
+	{
+	  INC (conflicts);
+	  if (!solver->level)
+	    {
+	      LOG ("learned empty clause from Gauss-Jordan elimination");
+	      solver->inconsistent = true;
+	      CHECK_AND_ADD_EMPTY ();
+	      ADD_EMPTY_TO_PROOF ();
+	    }
+	}
+      STOP (gauss);
+      if (!res)
+	res = kissat_search_propagate (solver);
+    }
+  return res;
+}
@@ -0,0 +1,60 @@
+#ifndef _gauss_h_INCLUDED
+#define _gauss_h_INCLUDED
+
+#include "stack.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Gauss-Jordan elimination on XOR constraints extracted from irredundant
+// clauses.  The constraints are kept in 'xors' over external variables as
+// records of size, right-hand side and variables, which survives variable
+// compaction.  From these the dense bit-matrix ('words' 64-bit words per
+// row) over the internal variables in 'vars' is built at the root level.
+
+// The matrix is kept in reduced row echelon form, where each row has a
+// 'basic' column which occurs in no other row.  Whenever the basic
+// variable of a row is assigned the row is pivoted on another unassigned
+// variable of the row.  As with two watched literals, each row further
+// 'watch'es one non-basic column (rows watching a column are kept in
+// 'watches'), and only rows for which the basic or the watched variable
+// was assigned are checked.  Backtracking does not require any change to
+// the matrix and only resets 'propagated', the position of the next
+// literal on the trail to be processed.
+
+typedef struct gauss gauss;
+
+struct gauss
+{
+  bool enabled;
+  bool dirty;
+  bool rescan;
+  unsigned rows;
+  unsigned columns;
+  unsigned words;
+  unsigned size;
+  unsigned propagated;
+  uint64_t *matrix;
+  bool *rhs;
+  bool *queued;
+  unsigned *basic;
+  unsigned *watch;
+  unsigned *pivot;
+  unsigned *vars;
+  unsigned *column;
+  unsigneds *watches;
+  ints xors;
+  unsigneds check;
+};
+
+struct clause;
+struct kissat;
+
+void kissat_init_gauss (struct kissat *);
+void kissat_reset_gauss (struct kissat *);
+void kissat_release_gauss (struct kissat *);
+
+bool kissat_gaussing (struct kissat *);
+struct clause *kissat_gauss_propagate (struct kissat *);
+
+#endif
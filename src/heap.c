@@ -28,20 +28,16 @@ kissat_check_heap (heap * heap)
       const unsigned idx = stack[i];
       const unsigned idx_pos = pos[idx];
       assert (idx_pos == i);
-      unsigned child_pos = HEAP_CHILD (idx_pos);
-      unsigned parent_pos = HEAP_PARENT (child_pos);
-      assert (parent_pos == idx_pos);
-      if (child_pos < end)
+      const unsigned child_pos = HEAP_CHILD (idx_pos);
+      const unsigned last_pos = child_pos + HEAP_ARITY;
+      for (unsigned other_pos = child_pos; other_pos < last_pos; other_pos++)
 	{
-	  unsigned child = stack[child_pos];
+	  const unsigned parent_pos = HEAP_PARENT (other_pos);
+	  assert (parent_pos == idx_pos);
+	  if (other_pos >= end)
+	    break;
+	  const unsigned child = stack[other_pos];
 	  assert (score[idx] >= score[child]);
-	  if (++child_pos < end)
-	    {
-	      parent_pos = HEAP_PARENT (child_pos);
-	      assert (parent_pos == idx_pos);
-	      child = stack[child_pos];
-	      assert (score[idx] >= score[child]);
-	    }
 	}
     }
 }
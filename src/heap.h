@@ -11,6 +11,15 @@
 #define DISCONTAIN UINT_MAX
 #define DISCONTAINED(IDX) ((int)(IDX) < 0)
 
+// Number of children of a heap node, which can be set at compile time,
+// e.g., with 'CC="gcc -DHEAP_ARITY=4" ./configure'.  A larger arity makes
+// the heap shallower and thus bubbling up cheaper, while bubbling down has
+// to compare more children, which are consecutive on the heap stack.
+
+#ifndef HEAP_ARITY
+#define HEAP_ARITY 2
+#endif
+
 typedef struct heap heap;
 
 struct heap
@@ -86,6 +86,7 @@ kissat_assignment_level (kissat * solver,
 			 value * values, assigned * assigned,
 			 unsigned lit, clause * reason)
 {
+  const unsigned current_level = solver->level;
   unsigned res = 0;
   for (all_literals_in_clause (other, reason))
     {
@@ -95,12 +96,14 @@ kissat_assignment_level (kissat * solver,
       const unsigned other_idx = IDX (other);
       struct assigned *a = assigned + other_idx;
       const unsigned level = a->level;
+      assert (level <= current_level);
       if (res < level)
-	res = level;
+	{
+	  res = level;
+	  if (res == current_level)
+	    break;
+	}
     }
-#ifdef NDEBUG
-  (void) solver;
-#endif
   return res;
 }
 
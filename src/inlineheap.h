@@ -6,10 +6,10 @@
 #include "logging.h"
 
 #define HEAP_CHILD(POS) \
-  (assert ((POS) < (1u<<31)), (2*(POS) + 1))
+  (assert ((POS) < UINT_MAX / HEAP_ARITY), (HEAP_ARITY*(POS) + 1))
 
 #define HEAP_PARENT(POS) \
-  (assert ((POS) > 0), (((POS) - 1)/2))
+  (assert ((POS) > 0), (((POS) - 1)/HEAP_ARITY))
 
 static inline void
 kissat_bubble_up (kissat * solver, heap * heap, unsigned idx)
@@ -54,8 +54,9 @@ kissat_bubble_down (kissat * solver, heap * heap, unsigned idx)
 	break;
       unsigned child = stack[child_pos];
       double child_score = score[child];
-      const unsigned sibling_pos = child_pos + 1;
-      if (sibling_pos < end)
+      const unsigned last_pos = MIN (child_pos + HEAP_ARITY, end);
+      for (unsigned sibling_pos = child_pos + 1;
+	   sibling_pos < last_pos; sibling_pos++)
 	{
 	  const unsigned sibling = stack[sibling_pos];
 	  const double sibling_score = score[sibling];
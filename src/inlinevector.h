@@ -158,7 +158,11 @@ kissat_push_vectors (kissat * solver, vector * vector, unsigned e)
     )
     {
       if (EMPTY_STACK (*stack))
-	PUSH_STACK (*stack, 0);
+	{
+	  START_MEMORY (watches);
+	  PUSH_STACK (*stack, 0);
+	  STOP_MEMORY (watches);
+	}
       if (FULL_STACK (*stack))
 	{
 	  unsigned *end = kissat_enlarge_vector (solver, vector);
@@ -1,5 +1,6 @@
 #include "allocate.h"
 #include "backtrack.h"
+#include "degrade.h"
 #include "error.h"
 #include "search.h"
 #include "import.h"
@@ -11,6 +12,7 @@
 #include "resize.h"
 #include "resources.h"
 #include "clauseimport.h"
+#include "trace.h"
 
 #include <assert.h>
 #include <inttypes.h>
@@ -27,7 +29,7 @@ kissat_init (void)
 #else
   kissat_init_options ();
 #endif
-#ifndef QUIET
+#if !defined(QUIET) || defined(COUNTERS)
   kissat_init_profiles (&solver->profiles);
 #endif
   START (total);
@@ -58,6 +60,7 @@ kissat_init (void)
   solver->initial_variable_phases = 0;
   solver->initial_variable_phases_len = 0;
 
+  solver->num_exported_clauses = 0;
   solver->num_imported_external_clauses = 0;
   solver->num_discarded_external_clauses = 0;
 
@@ -111,10 +114,12 @@ kissat_release (kissat * solver)
 
   kissat_release_phases (solver);
   kissat_release_cache (solver);
-  RELEASE_STACK (solver->nonces);
+  kissat_release_nonces (solver);
 
   RELEASE_STACK (solver->export);
   RELEASE_STACK (solver->import);
+  kissat_release_share (solver);
+  kissat_release_gauss (solver);
 
   DEALLOC_VARIABLE_INDEXED (assigned);
   DEALLOC_VARIABLE_INDEXED (flags);
@@ -122,15 +127,19 @@ kissat_release (kissat * solver)
 
   DEALLOC_LITERAL_INDEXED (marks);
   DEALLOC_LITERAL_INDEXED (values);
+  START_MEMORY (watches);
   DEALLOC_LITERAL_INDEXED (watches);
+  STOP_MEMORY (watches);
 
   RELEASE_STACK (solver->import);
   RELEASE_STACK (solver->eliminated);
+  START_MEMORY (extend);
   RELEASE_STACK (solver->extend);
+  STOP_MEMORY (extend);
   RELEASE_STACK (solver->witness);
   RELEASE_STACK (solver->etrail);
 
-  RELEASE_STACK (solver->vectors.stack);
+  kissat_release_vectors (solver);
   RELEASE_STACK (solver->delayed);
 
   RELEASE_STACK (solver->clause);
@@ -139,7 +148,7 @@ kissat_release (kissat * solver)
   RELEASE_STACK (solver->resolvent);
 #endif
 
-  RELEASE_STACK (solver->arena);
+  kissat_release_arena (solver);
 
   RELEASE_STACK (solver->units);
   RELEASE_STACK (solver->frames);
@@ -174,13 +183,21 @@ kissat_release (kissat * solver)
   RELEASE_STACK (solver->original);
 #endif
 
-#ifndef QUIET
-  RELEASE_STACK (solver->profiles.stack);
+#if !defined(QUIET) || defined(COUNTERS)
+  kissat_release_profiles (solver);
+  kissat_release_trace (solver);
 #endif
 
 #ifndef NDEBUG
   kissat_release_checker (solver);
 #endif
+#ifndef NDEBUG
+  for (unsigned i = 0; i < SIZE_MEMORY_CATEGORIES; i++)
+    if (solver->memory.current[i] && !getenv ("LEAK"))
+      kissat_fatal ("internally leaking %" PRIu64 " bytes "
+		    "of memory category '%s'",
+		    solver->memory.current[i], kissat_memory_category_names[i]);
+#endif
 #if !defined(NDEBUG) && defined(METRICS)
   uint64_t leaked = solver->statistics.allocated_current;
   if (leaked)
@@ -260,6 +277,31 @@ kissat_set_conflict_limit (kissat * solver, unsigned limit)
        limits->conflicts, limit);
 }
 
+void
+kissat_set_ticks_limit (kissat * solver, unsigned limit)
+{
+  kissat_require_initialized (solver);
+  limits *limits = &solver->limits;
+  limited *limited = &solver->limited;
+  limited->ticks = true;
+  const uint64_t ticks = SEARCH_AND_PROBING_TICKS;
+  assert (UINT64_MAX - limit >= ticks);
+  limits->ticks = ticks + limit;
+  LOG ("set ticks limit to %" PRIu64 " after %u ticks",
+       limits->ticks, limit);
+}
+
+void
+kissat_set_memory_limit (kissat * solver, unsigned long bytes)
+{
+  kissat_require_initialized (solver);
+  limits *limits = &solver->limits;
+  limited *limited = &solver->limited;
+  limited->memory = (bytes > 0);
+  limits->memory = bytes;
+  LOG ("set memory limit to %" PRIu64 " bytes", limits->memory);
+}
+
 void
 kissat_print_statistics (kissat * solver)
 {
@@ -293,6 +335,10 @@ kissat_print_statistics (kissat * solver)
 #endif
   kissat_section (solver, "resources");
   kissat_print_resources (solver);
+#elif defined(COUNTERS)
+  kissat_require_initialized (solver);
+  if (GET_OPTION (profile))
+    kissat_profiles_print (solver);
 #endif
   (void) solver;
 }
@@ -561,7 +607,14 @@ kissat_solve (kissat * solver)
   kissat_require_initialized (solver);
   kissat_require (EMPTY_STACK (solver->clause),
 		  "incomplete clause (terminating zero not added)");
-  kissat_require (!GET (searches), "incremental solving not supported");
+  // Without any clause added in between (enforced by 'kissat_add')
+  // an interrupted search can be resumed.
+  kissat_require (!GET (searches) ||
+		  (!solver->inconsistent && solver->unassigned),
+		  "incremental solving not supported");
+#if !defined(QUIET) || defined(COUNTERS)
+  kissat_init_trace (solver);
+#endif
   return kissat_search (solver);
 }
 
@@ -626,6 +679,12 @@ void kissat_set_clause_import_callback (kissat * solver, void *state, void (*pro
   solver->produce_clause = produce;
 }
 
+void kissat_set_clause_sharing_barrier (kissat * solver, void *state, void (*barrier) (void *state, unsigned long epoch))
+{
+  solver->share.state = state;
+  solver->share.barrier = barrier;
+}
+
 struct kissat_statistics kissat_get_statistics (kissat * solver) 
 {
   statistics *statistics = &solver->statistics;
@@ -648,10 +707,151 @@ struct kissat_statistics kissat_get_statistics (kissat * solver)
   return stats_out;
 }
 
+struct kissat_memory_usage kissat_get_memory_usage (kissat * solver)
+{
+  kissat_require_initialized (solver);
+  const memory *memory = &solver->memory;
+  struct kissat_memory_usage usage;
+  usage.total.current = memory->total + sizeof *solver;
+  usage.total.peak = memory->peak + sizeof *solver;
+#define MEMORY_CATEGORY(NAME) \
+  usage.NAME.current = memory->current[MEMORY_ ## NAME]; \
+  usage.NAME.peak = memory->maximum[MEMORY_ ## NAME];
+  MEMORY_CATEGORIES
+#undef MEMORY_CATEGORY
+  usage.other.current += sizeof *solver;
+  usage.other.peak += sizeof *solver;
+  return usage;
+}
+
+void kissat_import_redundant_clause (kissat * solver, int *lits, int size, int glue)
+{
+  // Literal flags to possibly check against:
+  // bool eliminate:1; /* set by kissat_mark_removed_literal */
+  //!bool eliminated:1; /*do not import*/
+  // bool fixed:1; /*can be handled explicitly*/
+  // bool probe:1; /*could be fine*/
+  // bool subsume:1; /* set by kissat_mark_added_literal, also when importing the clause */
+  // bool sweep:1; /*could be fine*/
+  // bool transitive:1; /*seems to be used nowhere*/
+
+  // Analyze each of the literals
+  bool okToImport = true;
+  unsigned effectiveSize = 0;
+  for (unsigned i = 0; i < (unsigned)size; i++) {
+    int elit = lits[i];
+    if (!VALID_EXTERNAL_LITERAL (elit)) {
+      solver->r_ed++;
+      okToImport = false;
+      break;
+    }
+    const unsigned ilit = kissat_import_literal (solver, elit);
+    if (!VALID_INTERNAL_LITERAL (ilit)) {
+      solver->r_ed++;
+      okToImport = false;
+      break;
+    }
+    const unsigned idx = IDX (ilit);
+    flags *flags = FLAGS (idx);
+    if (flags->fixed) {
+      const value value = kissat_fixed (solver, ilit);
+      if (value > 0) {
+        // Literal is fixed as positive: drop entire clause
+        solver->r_fx++;
+        okToImport = false;
+        break;
+      } else if (value < 0) {
+        // Literal is fixed as negated: drop this literal
+        lits[i] = 0;
+      } else {
+        // Fixed, but neither positive nor negated? Drop clause to be safe
+        solver->r_fx++;
+        okToImport = false;
+        break;
+      }
+    } else if (!flags->active || flags->eliminated) {
+      // Literal in an invalid state for importing this clause
+      okToImport = false;
+
+      if (!flags->active) solver->r_ia++;
+      if (flags->eliminate) solver->r_ee++;
+      if (flags->eliminated) solver->r_ed++;
+      if (flags->probe) solver->r_pb++;
+      if (flags->subsume) solver->r_ss++;
+      if (flags->sweep) solver->r_sw++;
+      if (flags->transitive) solver->r_tr++;
+
+      break;
+    } else {
+      // This literal is fine
+      effectiveSize++;
+    }
+  }
+
+  // Drop clause, or no valid literals?
+  if (!okToImport || effectiveSize == 0) {
+    solver->num_discarded_external_clauses++;
+    return;
+  }
+
+  if (effectiveSize == 1) {
+    // Unit clause!
+
+    // Get literal
+    unsigned i = 0; while (lits[i] == 0) i++;
+    const unsigned lit = kissat_import_literal (solver, lits[i]);
+    assert (VALID_INTERNAL_LITERAL (lit));
+
+    // Learn unit clause
+    //printf("KISSAT LEARN %i\n", lit);
+    kissat_learned_unit (solver, lit);
+    solver->num_imported_external_clauses++;
+    return;
+  }
+
+  // Larger clause of size >= 2
+
+  if (effectiveSize > CAPACITY_STACK (solver->clause)) {
+    // Clause is too large
+    solver->r_tl++;
+    solver->num_discarded_external_clauses++;
+    return;
+  }
+
+  // Write clause into internal stack
+  assert (EMPTY_STACK (solver->clause));
+  //printf("KISSAT LEARN");
+  for (unsigned i = 0; i < (unsigned)size; i++) {
+    if (lits[i] == 0) continue;
+    const unsigned lit = kissat_import_literal (solver, lits[i]);
+    assert (VALID_INTERNAL_LITERAL (lit));
+    PUSH_STACK (solver->clause, lit);
+    //printf(" %i", lit);
+  }
+  //printf("\n");
+  assert (SIZE_STACK (solver->clause) == effectiveSize);
+
+  // Learn clause
+  const reference ref = kissat_new_redundant_clause (solver, glue);
+
+  if (ref != INVALID_REF) {
+    // Valid reference => Long clause (size>2) 
+    assert (effectiveSize > 2);
+    clause *c = kissat_dereference_clause (solver, ref);
+    c->used = 1 + (glue <= GET_OPTION (tier2));
+  }
+
+  // Clear internal stack for the next learnt clause
+  CLEAR_STACK (solver->clause);
+  solver->num_imported_external_clauses++;
+}
+
 bool kissat_importing_redundant_clauses (kissat * solver) 
 {
   if (solver->produce_clause == 0) return false;
+  if (GET_OPTION (shareepoch)) return false;
   if (solver->level != 0) return false;
+  if (solver->memory.degraded >= DEGRADED_ISOLATED) return false;
   unsigned long conflicts = solver->statistics.conflicts;
   if (conflicts == solver->num_conflicts_at_last_import) return false;
   return true;
@@ -663,6 +863,10 @@ void kissat_import_redundant_clauses (kissat * solver)
   int size = 0;
   int glue = 0;
   solver->num_conflicts_at_last_import = solver->statistics.conflicts;
+  TRACE_BEGIN ("import");
+#if !defined(QUIET) || defined(COUNTERS)
+  const unsigned long imported_before = solver->num_imported_external_clauses;
+#endif
 
   while (true) {
     solver->produce_clause (solver->produce_clause_state, &buffer, &size, &glue);
@@ -673,127 +877,15 @@ void kissat_import_redundant_clauses (kissat * solver)
       break; // No more clauses
     }
 
-    // Literal flags to possibly check against:
-    // bool eliminate:1; /* set by kissat_mark_removed_literal */
-    //!bool eliminated:1; /*do not import*/
-    // bool fixed:1; /*can be handled explicitly*/
-    // bool probe:1; /*could be fine*/
-    // bool subsume:1; /* set by kissat_mark_added_literal, also when importing the clause */
-    // bool sweep:1; /*could be fine*/
-    // bool transitive:1; /*seems to be used nowhere*/
-
-    // Analyze each of the literals
-    bool okToImport = true;
-    unsigned effectiveSize = 0;
-    for (unsigned i = 0; i < (unsigned)size; i++) {
-      int elit = buffer[i];
-      if (!VALID_EXTERNAL_LITERAL (elit)) {
-	solver->r_ed++;
-        okToImport = false;
-        break;
-      }
-      const unsigned ilit = kissat_import_literal (solver, elit);
-      if (!VALID_INTERNAL_LITERAL (ilit)) {
-	solver->r_ed++;
-        okToImport = false;
-        break;
-      }
-      const unsigned idx = IDX (ilit);
-      flags *flags = FLAGS (idx);
-      if (flags->fixed) {
-        const value value = kissat_fixed (solver, ilit);
-        if (value > 0) {
-          // Literal is fixed as positive: drop entire clause
-          solver->r_fx++;
-          okToImport = false;
-          break;
-        } else if (value < 0) {
-          // Literal is fixed as negated: drop this literal
-          buffer[i] = 0;
-        } else {
-          // Fixed, but neither positive nor negated? Drop clause to be safe
-          solver->r_fx++;
-          okToImport = false;
-          break;
-        }
-      } else if (!flags->active || flags->eliminated) {
-        // Literal in an invalid state for importing this clause
-        okToImport = false;
-
-        if (!flags->active) solver->r_ia++;
-        if (flags->eliminate) solver->r_ee++;
-        if (flags->eliminated) solver->r_ed++;
-        if (flags->probe) solver->r_pb++;
-        if (flags->subsume) solver->r_ss++;
-        if (flags->sweep) solver->r_sw++;
-        if (flags->transitive) solver->r_tr++;
-
-        break;
-      } else {
-        // This literal is fine
-        effectiveSize++;
-      }
-    }
-
-    // Drop clause, or no valid literals?
-    if (!okToImport || effectiveSize == 0) {
-      solver->num_discarded_external_clauses++;
-      continue;
-    }
-
-    if (effectiveSize == 1) {
-      // Unit clause!
-
-      // Get literal
-      unsigned i = 0; while (buffer[i] == 0) i++;
-      const unsigned lit = kissat_import_literal (solver, buffer[i]);
-      assert (VALID_INTERNAL_LITERAL (lit));
-
-      // Learn unit clause
-      //printf("KISSAT LEARN %i\n", lit);
-      kissat_learned_unit (solver, lit);
-      solver->num_imported_external_clauses++;
-      continue;
-    }
-
-    // Larger clause of size >= 2
-
-    if (effectiveSize > CAPACITY_STACK (solver->clause)) {
-      // Clause is too large
-      solver->r_tl++;
-      solver->num_discarded_external_clauses++;
-      continue;
-    }
-
-    // Write clause into internal stack
-    assert (EMPTY_STACK (solver->clause));
-    //printf("KISSAT LEARN");
-    for (unsigned i = 0; i < (unsigned)size; i++) {
-      if (buffer[i] == 0) continue;
-      const unsigned lit = kissat_import_literal (solver, buffer[i]);
-      assert (VALID_INTERNAL_LITERAL (lit));
-      PUSH_STACK (solver->clause, lit);
-      //printf(" %i", lit);
-    }
-    //printf("\n");
-    assert (SIZE_STACK (solver->clause) == effectiveSize);
-
-    // Learn clause
-    const reference ref = kissat_new_redundant_clause (solver, glue);
-
-    if (ref != INVALID_REF) {
-      // Valid reference => Long clause (size>2) 
-      assert (effectiveSize > 2);
-      clause *c = kissat_dereference_clause (solver, ref);
-      c->used = 1 + (glue <= GET_OPTION (tier2));
-    }
-
-    // Clear internal stack for the next learnt clause
-    CLEAR_STACK (solver->clause);
-    solver->num_imported_external_clauses++;
+    kissat_import_redundant_clause (solver, buffer, size, glue);
   }
 
   //printf("KISSAT next import @ %lu conflicts\n", solver->num_conflicts_at_last_import);
+
+  TRACE_END ("import",
+	     solver->num_imported_external_clauses - imported_before);
+  TRACE_COUNTER ("exported", solver->num_exported_clauses);
+  TRACE_COUNTER ("imported", solver->num_imported_external_clauses);
 }
 
 void kissat_set_initial_variable_phases (kissat * solver, signed char *lookup, int size)
@@ -801,3 +893,47 @@ void kissat_set_initial_variable_phases (kissat * solver, signed char *lookup, i
   solver->initial_variable_phases = lookup;
   solver->initial_variable_phases_len = size;
 }
+
+int kissat_get_cached_phases (kissat * solver, signed char *phases, int size)
+{
+  kissat_require_initialized (solver);
+  const line *const line = kissat_minimum_cache_line (solver);
+  if (!line)
+    return -1;
+  const unsigned vars = line->vars;
+  const bits *const bits = line->bits;
+  const size_t imported = SIZE_STACK (solver->import);
+  const size_t end = size < 0 ? 0 : MIN (imported, (size_t) size);
+  for (size_t eidx = 1; eidx < end; eidx++)
+    {
+      const import *const import = &PEEK_STACK (solver->import, eidx);
+      if (!import->imported || import->eliminated)
+	continue;
+      const unsigned ilit = import->lit;
+      const unsigned iidx = IDX (ilit);
+      assert (iidx < vars);
+      signed char value = kissat_fixed (solver, ilit);
+      if (!value)
+	{
+	  value = kissat_get_bit (bits, vars, iidx) ? 1 : -1;
+	  if (NEGATED (ilit))
+	    value = -value;
+	}
+      phases[eidx] = value;
+    }
+  assert (line->unsatisfied <= INT_MAX);
+  return line->unsatisfied;
+}
+
+int kissat_write_trace (kissat * solver, const char *path)
+{
+  kissat_require_initialized (solver);
+#if !defined(QUIET) || defined(COUNTERS)
+  if (!solver->trace.events)
+    return 0;
+  return kissat_write_trace_to_file (solver, path);
+#else
+  (void) path;
+  return 0;
+#endif
+}
@@ -1,6 +1,7 @@
 #ifndef _internal_h_INCLUDED
 #define _internal_h_INCLUDED
 
+#include "allocate.h"
 #include "arena.h"
 #include "array.h"
 #include "assign.h"
@@ -15,6 +16,7 @@
 #include "flags.h"
 #include "format.h"
 #include "frames.h"
+#include "gauss.h"
 #include "heap.h"
 #include "kissat.h"
 #include "limits.h"
@@ -29,6 +31,7 @@
 #include "random.h"
 #include "reap.h"
 #include "reluctant.h"
+#include "share.h"
 #include "rephase.h"
 #include "stack.h"
 #include "statistics.h"
@@ -147,6 +150,8 @@ struct kissat
   unsigned_array trail;
   unsigned *propagate;
 
+  gauss gauss;
+
   unsigned best_assigned;
   unsigned target_assigned;
   unsigned unflushed;
@@ -204,6 +209,7 @@ struct kissat
   unsigned walked;
 
   statistics statistics;
+  memory memory;
   mode mode;
 
   uint64_t ticks;
@@ -233,8 +239,13 @@ struct kissat
   size_t offset_of_last_original_clause;
 #endif
 
-#ifndef QUIET
+#if !defined(QUIET) || defined(COUNTERS)
   profiles profiles;
+  trace trace;
+#endif
+
+#ifndef QUIET
+  double collect_pause;
 #endif
 
 #ifndef NOPTIONS
@@ -260,11 +271,15 @@ struct kissat
   void (*produce_clause) (void *state, int **clause, int *size, int *glue);
   unsigned long num_conflicts_at_last_import;
 
+  // Deterministic clause sharing
+  share share;
+
   // Initial variable phases
   signed char *initial_variable_phases;
   int initial_variable_phases_len;
 
   // Additional statistics
+  unsigned long num_exported_clauses;
   unsigned long num_imported_external_clauses;
   unsigned long num_discarded_external_clauses;
   unsigned long r_ee,r_ed,r_pb,r_ss,r_sw,r_tr,r_fx,r_ia,r_tl;
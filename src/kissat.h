@@ -53,6 +53,18 @@ void kissat_set_clause_export_callback (kissat * solver, void *state, int *buffe
 // If no clause is available, the function must return clause == 0.
 void kissat_set_clause_import_callback (kissat * solver, void *state, void (*produce) (void *state, int **clause, int *size, int *glue));
 
+// Deterministic clause sharing is enabled by setting the option 'shareepoch' to a number of 'ticks'.
+// Then clauses are only exchanged at the first decision after an epoch of that many ticks ended:
+// the clauses learned since the last exchange are passed to the export callback (in learned order),
+// then the given barrier function is called with the provided state and the current epoch number,
+// and finally all clauses returned by the import callback are imported in a canonical order (sorted
+// by size, literals and glue, with duplicates removed) which does not depend on the order in which
+// they are produced. Epoch numbers increase but are not necessarily consecutive. If the barrier
+// returns once every other solver has passed its barrier for some epoch at least as large and the
+// import callback then yields exactly the clauses exported by the other solvers in those epochs,
+// runs with the same seeds and number of solvers follow the same search trajectory.
+void kissat_set_clause_sharing_barrier (kissat * solver, void *state, void (*barrier) (void *state, unsigned long epoch));
+
 // Basic "external" statistics struct with some interesting properties of kissat's search.
 struct kissat_statistics {unsigned long propagations; unsigned long decisions; unsigned long conflicts; unsigned long restarts; 
 unsigned long imported; unsigned long discarded; unsigned long r_ee,r_ed,r_pb,r_ss,r_sw,r_tr,r_fx,r_ia,r_tl;};
@@ -65,6 +77,46 @@ struct kissat_statistics kissat_get_statistics (kissat * solver);
 // on the variable's initial phase. The array must be valid during the entire search procedure.
 void kissat_set_initial_variable_phases (kissat * solver, signed char *lookup, int size);
 
+// Writes the best assignment found by local search so far (the cached assignment with the
+// fewest unsatisfied clauses) to phases[i] as 1 or -1 for each imported and not eliminated
+// external variable i < size. Variables fixed at the root level get their fixed value instead
+// of the cached one, which might contradict it. Other entries are left untouched. Returns the
+// number of unsatisfied clauses of that assignment, or -1 if no assignment is cached.
+// Together with kissat_set_initial_variable_phases this allows the caller to share good
+// assignments between solvers and to persist them across restarts.
+int kissat_get_cached_phases (kissat * solver, signed char *phases, int size);
+
+// Writes the events recorded so far (search mode switches, restarts, rephasing, reductions,
+// garbage collections, simplifications, local search, clause imports and export batches) in the
+// Chrome trace event format (JSON) to the given file. Recording is enabled by setting the
+// 'traceevents' option to the number of events kept in the ring buffer before 'kissat_solve'.
+// Timestamps are wall-clock microseconds since the epoch to allow aligning traces of several
+// solvers. Returns zero if nothing was recorded, if the file could not be written, or if the
+// library was configured with '--quiet' but without '--counters'.
+int kissat_write_trace (kissat * solver, const char *path);
+
+// Current and peak number of bytes allocated by the solver, in total and for the main memory
+// consumers: the clause arena, the assignment cache, the extension stack for witness reconstruction,
+// the 'kitten' sub-solver, the local search walker and the watch lists. Everything else is
+// accounted as 'other'. Allocator overhead and fragmentation are not included.
+struct kissat_memory {unsigned long current; unsigned long peak;};
+struct kissat_memory_usage {struct kissat_memory total, arena, cache, extend, kitten, walker, watches, other;};
+struct kissat_memory_usage kissat_get_memory_usage (kissat * solver);
+
+// Limits the total number of bytes allocated by the solver (as reported by kissat_get_memory_usage).
+// Close to the limit (option 'degradelim' in percent) the solver first reduces learned clauses early,
+// then disables local search, sweeping and the assignment cache, and then stops importing clauses.
+// If the limit is still exceeded, kissat_solve returns 0 (unknown). Unlike conflict and decision
+// limits the memory limit is kept for subsequent calls to kissat_solve. Zero removes the limit.
+void kissat_set_memory_limit (kissat * solver, unsigned long bytes);
+
+// Limits the next call to kissat_solve to the given number of 'ticks' (cache line accesses during
+// search and probing), a deterministic and machine-independent measure of work. Like conflict and
+// decision limits it only applies to the next call. If kissat_solve returns 0 (unknown) due to one of
+// these limits (or termination), calling kissat_solve again resumes the interrupted search exactly
+// where it stopped, which allows to solve in slices of bounded work (no clauses can be added though).
+void kissat_set_ticks_limit (kissat * solver, unsigned limit);
+
 // TODO get branching literal: use kissat_next_decision_variable in decide.h ?
 
 #endif
@@ -116,6 +116,66 @@ do { \
 
 #define KITTEN_TICKS (solver->statistics.kitten_ticks)
 
+// All memory of 'kitten' is accounted to its own memory category.
+
+static void
+start_kitten_memory (struct kissat *kissat, unsigned *saved)
+{
+  *saved = kissat->memory.category;
+  kissat->memory.category = MEMORY_kitten;
+}
+
+static void
+stop_kitten_memory (struct kissat *kissat, unsigned saved)
+{
+  assert (kissat->memory.category == MEMORY_kitten);
+  kissat->memory.category = saved;
+}
+
+static void *
+kitten_calloc (struct kissat *kissat, size_t n, size_t size)
+{
+  unsigned saved;
+  start_kitten_memory (kissat, &saved);
+  void *res = kissat_calloc (kissat, n, size);
+  stop_kitten_memory (kissat, saved);
+  return res;
+}
+
+static void
+kitten_dealloc (struct kissat *kissat, void *ptr, size_t n, size_t size)
+{
+  unsigned saved;
+  start_kitten_memory (kissat, &saved);
+  kissat_dealloc (kissat, ptr, n, size);
+  stop_kitten_memory (kissat, saved);
+}
+
+static void
+kitten_enlarge_stack (struct kissat *kissat, chars * stack, size_t size)
+{
+  unsigned saved;
+  start_kitten_memory (kissat, &saved);
+  kissat_stack_enlarge (kissat, stack, size);
+  stop_kitten_memory (kissat, saved);
+}
+
+#undef CALLOC
+#undef DEALLOC
+#undef ENLARGE_STACK
+
+#define CALLOC(P,N) \
+do { (P) = kitten_calloc (solver, (N), sizeof *(P)); } while (0)
+
+#define DEALLOC(P,N) \
+do { kitten_dealloc (solver, (P), (N), sizeof *(P)); } while (0)
+
+#define ENLARGE_STACK(S) \
+do { \
+  assert (FULL_STACK (S)); \
+  kitten_enlarge_stack (solver, (chars*) &(S), sizeof *(S).begin); \
+} while (0)
+
 /*------------------------------------------------------------------------*/
 #endif // STAND_ALONE_KITTEN
 /*------------------------------------------------------------------------*/
@@ -1074,7 +1134,7 @@ kitten_release (kitten * kitten)
 #ifdef STAND_ALONE_KITTEN
   free (kitten);
 #else
-  kissat_free (kitten->kissat, kitten, sizeof *kitten);
+  kitten_dealloc (kitten->kissat, kitten, 1, sizeof *kitten);
 #endif
 }
 
@@ -1237,8 +1297,9 @@ static inline void
 unassign (kitten * kitten, value * values, unsigned lit)
 {
   const unsigned not_lit = lit ^ 1;
-  assert (values[lit] > 0);
-  assert (values[not_lit] < 0);
+  // Trail literals might have been flipped by 'kitten_flip_literal'.
+  assert (values[lit]);
+  assert (values[lit] == -values[not_lit]);
   const unsigned idx = lit / 2;
 #ifdef LOGGING
   kar *var = kitten->vars + idx;
@@ -2107,6 +2168,91 @@ kitten_failed (kitten * kitten, unsigned elit)
   return kitten->failed[ilit];
 }
 
+// Try to flip the value of the variable of the given literal in the
+// current model without falsifying any clause.  In a complete model every
+// clause has a true watched literal.  Thus only clauses watching the
+// currently true literal need to be checked and can be kept satisfied by
+// moving their watch to another true literal.  Variables assigned at the
+// root level are implied by unit clauses, which are not watched, and are
+// never flipped.  Neither are assumed literals, since the model has to
+// satisfy all assumptions.
+
+bool
+kitten_flip_literal (kitten * kitten, unsigned elit)
+{
+  REQUIRE_STATUS (10);
+  const unsigned eidx = elit / 2;
+  if (eidx >= kitten->evars)
+    return false;
+  unsigned iidx = kitten->import[eidx];
+  if (!iidx)
+    return false;
+  const unsigned idx = iidx - 1;
+  if (!kitten->vars[idx].level)
+    return false;
+  value *values = kitten->values;
+  unsigned lit = 2 * idx;
+  if (values[lit] < 0)
+    lit ^= 1;
+  assert (values[lit] > 0);
+  for (all_stack (unsigned, assumption, kitten->assumptions))
+    if (assumption == lit)
+      {
+	LOG ("refusing to flip assumed %u", lit);
+	return false;
+      }
+  LOG ("trying to flip %u", lit);
+  katches *watches = kitten->watches + lit;
+  unsigned *q = BEGIN_STACK (*watches);
+  const unsigned *const end_watches = END_STACK (*watches);
+  unsigned const *p = q;
+  uint64_t ticks = (((char *) end_watches - (char *) q) >> 7) + 1;
+  bool res = true;
+  while (p != end_watches)
+    {
+      const unsigned ref = *q++ = *p++;
+      klause *c = dereference_klause (kitten, ref);
+      assert (c->size > 1);
+      unsigned *lits = c->lits;
+      const unsigned other = lits[0] ^ lits[1] ^ lit;
+      if (values[other] > 0)
+	continue;
+      const unsigned *const end_lits = lits + c->size;
+      unsigned *r, replacement = INVALID;
+      ticks++;
+      for (r = lits + 2; r != end_lits; r++)
+	{
+	  replacement = *r;
+	  assert (values[replacement]);
+	  if (values[replacement] > 0)
+	    break;
+	}
+      if (r == end_lits)
+	{
+	  ROG (ref, "flipping %u falsifies", lit);
+	  res = false;
+	  break;
+	}
+      ROG (ref, "unwatching %u in", lit);
+      lits[0] = other;
+      lits[1] = replacement;
+      *r = lit;
+      watch_klause (kitten, replacement, ref);
+      q--;
+    }
+  while (p != end_watches)
+    *q++ = *p++;
+  SET_END_OF_STACK (*watches, q);
+  ADD (kitten_ticks, ticks);
+  if (res)
+    {
+      LOG ("flipped %u", lit);
+      values[lit] = -1;
+      values[lit ^ 1] = 1;
+    }
+  return res;
+}
+
 /*------------------------------------------------------------------------*/
 
 #ifdef STAND_ALONE_KITTEN
@@ -33,6 +33,7 @@ int kitten_solve (kitten *);
 
 signed char kitten_value (kitten *, unsigned);
 bool kitten_failed (kitten *, unsigned);
+bool kitten_flip_literal (kitten *, unsigned);
 
 unsigned kitten_compute_clausal_core (kitten *, uint64_t * learned);
 void kitten_shrink_to_clausal_core (kitten *);
@@ -148,6 +148,11 @@ kissat_learn_clause (kissat * solver)
     learn_reference (solver, not_uip, glue);
   
   if (solver->consume_clause && size <= solver->consume_clause_max_size) {
+    if (GET_OPTION (shareepoch)) {
+      // Export at the end of the current epoch.
+      kissat_defer_export (solver, glue);
+      return;
+    }
     // Export clause.
     const unsigned *lits = BEGIN_STACK (solver->clause);
     for (unsigned i = 0; i < size; i++) {
@@ -158,5 +163,6 @@ kissat_learn_clause (kissat * solver)
     }
     // Execute learnt clause callback
     solver->consume_clause (solver->consume_clause_state, size, glue);
+    solver->num_exported_clauses++;
   }
 }
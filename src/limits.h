@@ -54,7 +54,9 @@ struct limits
 {
   uint64_t conflicts;
   uint64_t decisions;
+  uint64_t memory;
   uint64_t reports;
+  uint64_t ticks;
 
   struct
   {
@@ -76,13 +78,15 @@ struct limits
   struct
   {
     uint64_t conflicts;
-  } probe, reduce, rephase, restart;
+  } degrade, probe, reduce, rephase, restart;
 };
 
 struct limited
 {
   bool conflicts;
   bool decisions;
+  bool memory;
+  bool ticks;
 };
 
 struct enabled
@@ -4,16 +4,29 @@
 
 static const size_t size_nonces = 32;
 
+// Nonces are only used for signatures of cached assignments and thus
+// accounted to the memory category of the cache.
+
 void
 kissat_init_nonces (kissat * solver)
 {
   LOG ("initializing %zu nonces", size_nonces);
   assert (EMPTY_STACK (solver->nonces));
   generator random = solver->random;
+  START_MEMORY (cache);
   for (size_t i = 0; i < size_nonces; i++)
     {
       uint64_t nonce = 1 | kissat_next_random64 (&random);
       LOG2 ("nonce[%zu] = 0x%016" PRIx64, i, nonce);
       PUSH_STACK (solver->nonces, nonce);
     }
+  STOP_MEMORY (cache);
+}
+
+void
+kissat_release_nonces (kissat * solver)
+{
+  START_MEMORY (cache);
+  RELEASE_STACK (solver->nonces);
+  STOP_MEMORY (cache);
 }
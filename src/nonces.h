@@ -12,5 +12,6 @@ STACK (uint64_t)
      struct kissat;
 
      void kissat_init_nonces (struct kissat *);
+     void kissat_release_nonces (struct kissat *);
 
 #endif
@@ -30,6 +30,10 @@ OPTION( definitioncores, 2, 1, 100, "how many cores") \
 OPTION( definitions, 1, 0, 1, "extract general definitions") \
 OPTION( defraglim, 75, 50, 100, "usable defragmentation limit in percent") \
 OPTION( defragsize, 1<<18, 10, INT_MAX, "size defragmentation limit") \
+OPTION( degrade, 1, 0, 1, "degrade gracefully close to memory limit") \
+OPTION( degradefraction, 90, 10, 100, "memory reduce fraction in percent") \
+OPTION( degradeint, 1e3, 1, 1e5, "memory reduce interval") \
+OPTION( degradelim, 90, 10, 100, "memory limit percent to degrade") \
 OPTION( delay, 2, 0, 10, "maximum delay (autarky, failed, ...)") \
 OPTION( eagersubsume, 20, 0, 100, "eagerly subsume recently learned clauses") \
 OPTION( eliminate, 1, 0, 1, "bounded variable elimination (BVE)") \
@@ -56,6 +60,10 @@ OPTION( failedrounds, 2, 1, 100, "failed literal probing rounds") \
 OPTION( forcephase, 0, 0, 1, "force initial phase") \
 OPTION( forward, 1, 0, 1, "forward subsumption in BVE") \
 OPTION( forwardeffort, 100, 0, 1e6, "effort in per mille") \
+OPTION( forwardtmp, 1e3, 0, INT_MAX, "resolvent checks per forward success") \
+OPTION( gauss, 1, 0, 1, "Gauss-Jordan elimination on XOR constraints") \
+OPTION( gaussclslim, 5, 3, 8, "maximum XOR constraint size") \
+OPTION( gaussvarslim, 2048, 1, 1e5, "maximum Gauss-Jordan matrix rows and columns") \
 OPTION( hyper, 1, 0, 1, "on-the-fly hyper binary resolution") \
 OPTION( ifthenelse, 1, 0, 1, "extract and eliminate if-then-else gates") \
 OPTION( incremental, 0, 0, 1, "enable incremental solving") \
@@ -73,7 +81,8 @@ OPTION( probe, 1, 0, 1, "enable probing") \
 OPTION( probedelay, 0, 0, 1, "delay probing") \
 OPTION( probeinit, 100, 0, INT_MAX, "initial probing interval") \
 OPTION( probeint, 100, 2, INT_MAX, "probing interval") \
-NQTOPT( profile, 2, 0, 4, "profile level") \
+PRFOPT( profile, 2, 0, 4, "profile level") \
+PRFOPT( profilecounters, COUNTERS_DEFAULT, 0, 1, "profile hardware performance counters") \
 OPTION( promote, 1, 0, 1, "promote clauses") \
 NQTOPT( quiet, 0, 0, 1, "disable all messages") \
 OPTION( really, 1, 0, 1, "delay preprocessing after scheduling") \
@@ -99,6 +108,7 @@ OPTION( restartint, RESTARTINT_DEFAULT, 1, 1e4, "base restart interval") \
 OPTION( restartmargin, 10, 0, 25, "fast/slow margin in percent") \
 OPTION( restartreusetrail, 1, 0, 1, "restarts reuse trail") \
 OPTION( seed, 0, 0, INT_MAX, "random seed") \
+OPTION( shareepoch, 0, 0, INT_MAX, "deterministic sharing epoch in ticks (0=asynchronous)") \
 OPTION( shrink, 3, 0, 3, "learned clauses (1=bin,2=lrg,3=rec)") \
 OPTION( shrinkminimize, 1, 0, 1, "minimize during shrinking") \
 OPTION( simplify, 1, 0, 1, "enable probing and elimination") \
@@ -113,6 +123,7 @@ OPTION( sweep, 1, 0, 1, "enable SAT sweeping") \
 OPTION( sweepclauses, 1000, 0, INT_MAX, "maximum environment clauses") \
 OPTION( sweepdepth, 2, 0, INT_MAX, "environment depth") \
 OPTION( sweepeffort, 20, 0, 1e4, "effort in per mille") \
+OPTION( sweepflip, 1, 0, 1, "flip backbone candidates in models") \
 OPTION( sweepmaxdepth, 4, 2, INT_MAX, "maximum environment depth") \
 OPTION( sweepvars, 100, 0, INT_MAX, "maximum environment variables") \
 OPTION( target, TARGET_DEFAULT, 0, 2, "target phases (1=stable,2=focused)") \
@@ -123,6 +134,9 @@ OPTION( ternaryheap, 1, 0, 1, "use heap to schedule ternary resolution") \
 OPTION( ternarymaxadd, 20, 0, 1e4, "maximum clauses added in percent") \
 OPTION( tier1, 2, 1, 100, "learned clause tier one glue limit") \
 OPTION( tier2, 6, 1,1e3, "learned clause tier two glue limit") \
+OPTION( tiers, 1, 0, 1, "segregate learned clauses by tier in arena") \
+OPTION( tiersmisplaced, 25, 0, 100, "misplaced learned clauses to segregate (in percent)") \
+PRFOPT( traceevents, 0, 0, 1e7, "trace ring buffer size (0=disabled)") \
 OPTION( transitive, 1, 0, 1, "transitive reduction of binary clauses") \
 OPTION( transitiveeffort, 20, 0, 2e3, "effort in per mille") \
 OPTION( transitivekeep, 1, 0, 1, "keep transitivity candidates") \
@@ -167,6 +181,12 @@ OPTION( xorsclslim, 5, 3, 31, "XOR extraction clause size limit") \
 #define STABLE_DEFAULT STABLE_UNSAT
 #endif
 
+#ifdef COUNTERS
+#define COUNTERS_DEFAULT 1
+#else
+#define COUNTERS_DEFAULT 0
+#endif
+
 #if defined(LOGGING) && !defined(QUIET)
 #define LOGOPT OPTION
 #else
@@ -179,6 +199,12 @@ OPTION( xorsclslim, 5, 3, 31, "XOR extraction clause size limit") \
 #define NQTOPT(...) /**/
 #endif
 
+#if !defined(QUIET) || defined(COUNTERS)
+#define PRFOPT OPTION
+#else
+#define PRFOPT(...) /**/
+#endif
+
 #ifndef NDEBUG
 #define DBGOPT OPTION
 #else
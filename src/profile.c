@@ -1,4 +1,8 @@
-#ifndef QUIET
+#if !defined(QUIET) || defined(COUNTERS)
+
+#ifdef __linux__
+#define _DEFAULT_SOURCE
+#endif
 
 #include "internal.h"
 #include "resources.h"
@@ -7,16 +11,259 @@
 #include <stdio.h>
 #include <string.h>
 
+#if defined(__linux__) && (defined(__x86_64__) || defined(__i386__))
+#define USER_SPACE_COUNTERS
+#include <linux/perf_event.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// The 'perf' field of profiles is zero as long as the counters have not
+// been opened yet.  Thus zero initialized profiles, as used in unit tests,
+// are uninitialized and never read from or close a file descriptor.
+
+#define PERF_UNINITIALIZED 0
+#define PERF_UNAVAILABLE -1
+#define PERF_AVAILABLE 1
+
+#define PERF_OPENED(PROFILES) ((PROFILES)->perf > 0)
+
 void
 kissat_init_profiles (profiles * profiles)
 {
 #define PROF(NAME,LEVEL) \
-  profiles->NAME = (profile) { LEVEL, #NAME, 0, 0 };
+  profiles->NAME = (profile) { LEVEL, false, #NAME, 0, 0, {0}, {0} };
   PROFS
 #undef PROF
+#define TRACE(NAME) \
+  profiles->NAME.traced = true;
+  TRACED
+#undef TRACE
+  profiles->perf = PERF_UNINITIALIZED;
 }
 
-#define SIZE_PROFS (sizeof (profiles) / sizeof (profile))
+enum
+{
+  SIZE_PROFS = 0
+#define PROF(NAME,LEVEL) + 1
+    PROFS
+#undef PROF
+};
+
+/*------------------------------------------------------------------------*/
+
+// All counters are opened as one group with the cycle counter as leader,
+// such that they are always scheduled together.  Each counter is mapped
+// into user space, which allows to read it with 'rdpmc' without a system
+// call.  The time conversion parameters on the page of the group leader
+// further allow to measure time with 'rdtsc'.  Thus starting and stopping
+// profiles stays cheap enough even around propagation and analysis.
+
+// If any of the counters can not be opened or read from user space (for
+// instance on virtual machines, due to restrictive 'perf_event_paranoid'
+// settings or if 'rdpmc' is disabled for user space) we fall back to only
+// measuring process time.
+
+#ifdef USER_SPACE_COUNTERS
+
+typedef volatile struct perf_event_mmap_page perf_page;
+
+#define BARRIER() __asm__ volatile ("":::"memory")
+
+static inline uint64_t
+rdpmc (uint32_t counter)
+{
+  uint32_t low, high;
+  __asm__ volatile ("rdpmc":"=a" (low), "=d" (high):"c" (counter));
+  return low | (uint64_t) high << 32;
+}
+
+static inline uint64_t
+rdtsc (void)
+{
+  uint32_t low, high;
+  __asm__ volatile ("rdtsc":"=a" (low), "=d" (high));
+  return low | (uint64_t) high << 32;
+}
+
+static int
+open_perf_counter (uint64_t config, int group)
+{
+  struct perf_event_attr attr;
+  memset (&attr, 0, sizeof attr);
+  attr.size = sizeof attr;
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return syscall (SYS_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+static void
+close_perf_counters (profiles * profiles, unsigned opened)
+{
+  const long page_size = sysconf (_SC_PAGESIZE);
+  while (opened--)
+    {
+      munmap (profiles->pages[opened], page_size);
+      close (profiles->descriptors[opened]);
+    }
+}
+
+static bool
+open_perf_counters (profiles * profiles)
+{
+  static const uint64_t configs[SIZE_PERF_COUNTERS] = {
+#define PERF_COUNTER(NAME,CONFIG) \
+    PERF_COUNT_HW_ ## CONFIG,
+    PERF_COUNTERS
+#undef PERF_COUNTER
+  };
+  const long page_size = sysconf (_SC_PAGESIZE);
+  int group = -1;
+  unsigned opened = 0;
+  while (opened < SIZE_PERF_COUNTERS)
+    {
+      const int fd = open_perf_counter (configs[opened], group);
+      if (fd < 0)
+	break;
+      void *page = mmap (0, page_size, PROT_READ, MAP_SHARED, fd, 0);
+      if (page == MAP_FAILED)
+	{
+	  close (fd);
+	  break;
+	}
+      perf_page *perf_page = page;
+      if (!perf_page->cap_user_rdpmc ||
+	  (group < 0 && !perf_page->cap_user_time))
+	{
+	  munmap (page, page_size);
+	  close (fd);
+	  break;
+	}
+      profiles->descriptors[opened] = fd;
+      profiles->pages[opened++] = page;
+      if (group < 0)
+	group = fd;
+    }
+  if (opened == SIZE_PERF_COUNTERS)
+    return true;
+  close_perf_counters (profiles, opened);
+  return false;
+}
+
+// Reading a counter or the time has to be retried if the kernel updated
+// the page concurrently (the 'lock' field is a sequence counter).
+
+static uint64_t
+read_perf_counter (perf_page * page)
+{
+  uint32_t sequence;
+  uint64_t count;
+  do
+    {
+      sequence = page->lock;
+      BARRIER ();
+      const uint32_t index = page->index;
+      count = page->offset;
+      if (index)
+	{
+	  const unsigned shift = 64 - page->pmc_width;
+	  count += (int64_t) (rdpmc (index - 1) << shift) >> shift;
+	}
+      BARRIER ();
+    }
+  while (page->lock != sequence);
+  return count;
+}
+
+static double
+read_perf_time (perf_page * page)
+{
+  uint32_t sequence;
+  uint64_t cycles;
+  uint32_t mult;
+  uint16_t shift;
+  do
+    {
+      sequence = page->lock;
+      BARRIER ();
+      mult = page->time_mult;
+      shift = page->time_shift;
+      cycles = rdtsc ();
+      BARRIER ();
+    }
+  while (page->lock != sequence);
+  const uint64_t quotient = cycles >> shift;
+  const uint64_t remainder = cycles & (((uint64_t) 1 << shift) - 1);
+  const uint64_t nanoseconds =
+    quotient * mult + ((remainder * mult) >> shift);
+  return 1e-9 * nanoseconds;
+}
+
+static double
+read_perf_counters (profiles * profiles)
+{
+  for (unsigned i = 0; i < SIZE_PERF_COUNTERS; i++)
+    profiles->counters[i] = read_perf_counter (profiles->pages[i]);
+  return profiles->offset + read_perf_time (profiles->pages[0]);
+}
+
+#else
+
+#define open_perf_counters(...) false
+#define close_perf_counters(...) do { } while (0)
+#define read_perf_counters(...) 0
+
+#endif
+
+// Time measured with 'rdtsc' continues process time at the point the
+// counters are opened, since the profiles already on the stack entered
+// with process time (at least 'total', which is started in 'kissat_init'
+// before options are set).
+
+static void
+init_perf_counters (profiles * profiles)
+{
+  assert (profiles->perf == PERF_UNINITIALIZED);
+  const double time = kissat_process_time ();
+  if (!open_perf_counters (profiles))
+    {
+      profiles->perf = PERF_UNAVAILABLE;
+      return;
+    }
+  profiles->perf = PERF_AVAILABLE;
+  profiles->offset = 0;
+  profiles->offset = time - read_perf_counters (profiles);
+  for (all_pointers (profile, p, profiles->stack))
+    memcpy (p->entered_counters, profiles->counters,
+	    sizeof profiles->counters);
+}
+
+static double
+profiles_now (kissat * solver)
+{
+  profiles *profiles = &solver->profiles;
+  if (profiles->perf == PERF_UNINITIALIZED &&
+      GET_OPTION (profilecounters))
+    init_perf_counters (profiles);
+  if (PERF_OPENED (profiles))
+    return read_perf_counters (profiles);
+  return kissat_process_time ();
+}
+
+void
+kissat_release_profiles (kissat * solver)
+{
+  profiles *profiles = &solver->profiles;
+  RELEASE_STACK (profiles->stack);
+  if (PERF_OPENED (profiles))
+    close_perf_counters (profiles, SIZE_PERF_COUNTERS);
+  profiles->perf = PERF_UNINITIALIZED;
+}
+
+/*------------------------------------------------------------------------*/
 
 static inline bool
 less_profile (profile * p, profile * q)
@@ -29,18 +276,36 @@ less_profile (profile * p, profile * q)
 }
 
 static void
-print_profile (profile * p, double total)
+print_profile (profile * p, double total, bool counters)
 {
-  printf ("c %14.2f %7.2f %%  %s\n",
-	  p->time, kissat_percent (p->time, total), p->name);
+  if (counters)
+    {
+      const uint64_t *c = p->counters;
+      const double kilo = c[PERF_instructions] / 1e3;
+      printf ("c %14.2f %7.2f %% %6.2f IPC %7.2f LLC %7.2f BR  %s\n",
+	      p->time, kissat_percent (p->time, total),
+	      kissat_average (c[PERF_instructions], c[PERF_cycles]),
+	      kissat_average (c[PERF_cache_misses], kilo),
+	      kissat_average (c[PERF_branch_misses], kilo), p->name);
+    }
+  else
+    printf ("c %14.2f %7.2f %%  %s\n",
+	    p->time, kissat_percent (p->time, total), p->name);
 }
 
 static double
-flush_profile (profile * profile, double now)
+flush_profile (profiles * profiles, profile * profile, double now)
 {
   const double delta = now - profile->entered;
   profile->time += delta;
   profile->entered = now;
+  if (PERF_OPENED (profiles))
+    for (unsigned i = 0; i < SIZE_PERF_COUNTERS; i++)
+      {
+	const uint64_t counter = profiles->counters[i];
+	profile->counters[i] += counter - profile->entered_counters[i];
+	profile->entered_counters[i] = counter;
+      }
   return delta;
 }
 
@@ -48,21 +313,25 @@ static void
 flush_profiles (profiles * profiles, const double now)
 {
   for (all_pointers (profile, p, profiles->stack))
-    flush_profile (p, now);
+    flush_profile (profiles, p, now);
 }
 
 static void
 push_profile (kissat * solver, profile * profile, double now)
 {
+  profiles *profiles = &solver->profiles;
   profile->entered = now;
-  PUSH_STACK (solver->profiles.stack, profile);
+  if (PERF_OPENED (profiles))
+    memcpy (profile->entered_counters, profiles->counters,
+	    sizeof profiles->counters);
+  PUSH_STACK (profiles->stack, profile);
 }
 
 void
 kissat_profiles_print (kissat * solver)
 {
   profiles *named = &solver->profiles;
-  double now = kissat_process_time ();
+  double now = profiles_now (solver);
   flush_profiles (named, now);
   profile *unsorted = (profile *) named;
   profile *sorted[SIZE_PROFS];
@@ -75,16 +344,19 @@ kissat_profiles_print (kissat * solver)
       sorted[size++] = p;
   INSERTION_SORT (profile *, size, sorted, less_profile);
   const double total = named->total.time;
+  const bool counters = PERF_OPENED (named);
+  if (GET_OPTION (profilecounters) && !counters)
+    printf ("c hardware performance counters not available\n");
   for (size_t i = 0; i < size; i++)
-    print_profile (sorted[i], total);
+    print_profile (sorted[i], total, counters);
   printf ("c =============================================\n");
-  print_profile (&named->total, total);
+  print_profile (&named->total, total, counters);
 }
 
 void
 kissat_start (kissat * solver, profile * profile)
 {
-  const double now = kissat_process_time ();
+  const double now = profiles_now (solver);
   push_profile (solver, profile, now);
 }
 
@@ -93,8 +365,8 @@ kissat_stop (kissat * solver, profile * profile)
 {
   assert (TOP_STACK (solver->profiles.stack) == profile);
   (void) POP_STACK (solver->profiles.stack);
-  const double now = kissat_process_time ();
-  flush_profile (profile, now);
+  const double now = profiles_now (solver);
+  flush_profile (&solver->profiles, profile, now);
 }
 
 void
@@ -102,7 +374,7 @@ kissat_stop_search_and_start_simplifier (kissat * solver, profile * profile)
 {
   struct profile *search = &PROFILE (search);
   assert (search->level <= GET_OPTION (profile));
-  const double now = kissat_process_time ();
+  const double now = profiles_now (solver);
   while (TOP_STACK (solver->profiles.stack) != search)
     {
       struct profile *mode = POP_STACK (solver->profiles.stack);
@@ -113,13 +385,13 @@ kissat_stop_search_and_start_simplifier (kissat * solver, profile * profile)
       else
 	assert (mode == &PROFILE (focused));
 #endif
-      flush_profile (mode, now);
+      flush_profile (&solver->profiles, mode, now);
     }
   (void) POP_STACK (solver->profiles.stack);
   struct profile *simplify = &PROFILE (simplify);
   assert (search->level == simplify->level);
   assert (simplify->level <= profile->level);
-  flush_profile (search, now);
+  flush_profile (&solver->profiles, search, now);
   push_profile (solver, simplify, now);
   if (profile->level <= GET_OPTION (profile))
     push_profile (solver, profile, now);
@@ -130,16 +402,20 @@ kissat_stop_simplifier_and_resume_search (kissat * solver, profile * profile)
 {
   struct profile *simplify = &PROFILE (simplify);
   struct profile *top = POP_STACK (solver->profiles.stack);
-  const double now = kissat_process_time ();
-  const double delta = flush_profile (simplify, now);
+  const double now = profiles_now (solver);
+  const double delta = flush_profile (&solver->profiles, simplify, now);
+#ifndef QUIET
 #ifndef NDEBUG
   const double entered = now - delta;
   assert (solver->mode.entered <= entered);
 #endif
   solver->mode.entered += delta;
+#else
+  (void) delta;
+#endif
   if (top == profile)
     {
-      flush_profile (profile, now);
+      flush_profile (&solver->profiles, profile, now);
       assert (TOP_STACK (solver->profiles.stack) == simplify);
       (void) POP_STACK (solver->profiles.stack);
     }
@@ -164,7 +440,7 @@ kissat_stop_simplifier_and_resume_search (kissat * solver, profile * profile)
 double
 kissat_time (kissat * solver)
 {
-  const double now = kissat_process_time ();
+  const double now = profiles_now (solver);
   flush_profiles (&solver->profiles, now);
   return PROFILE (total).time;
 }
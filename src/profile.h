@@ -1,9 +1,13 @@
 #ifndef _profile_h_INCLUDED
 #define _profile_h_INCLUDED
 
-#ifndef QUIET
+#if !defined(QUIET) || defined(COUNTERS)
 
 #include "stack.h"
+#include "trace.h"
+
+#include <stdbool.h>
+#include <stdint.h>
 
 typedef struct profile profile;
 typedef struct profiles profiles;
@@ -25,6 +29,7 @@ PROF(extend,2) \
 PROF(failed,2) \
 PROF(focused,2) \
 PROF(forward,4) \
+PROF(gauss,3) \
 PROF(minimize,3) \
 PROF(parse,1) \
 PROF(probe,2) \
@@ -34,6 +39,7 @@ PROF(reduce,2) \
 PROF(rephase,3) \
 PROF(restart,3) \
 PROF(search,1) \
+PROF(share,2) \
 PROF(shrink,3) \
 PROF(simplify,1) \
 PROF(sort,4) \
@@ -47,12 +53,48 @@ PROF(transitive,2) \
 PROF(vivify,2) \
 PROF(walking,2) \
 
+// Profiled phases which are also recorded as begin and end events in the
+// event trace if the 'traceevents' option is non-zero (see 'trace.h').
+
+#define TRACED \
+TRACE(collect) \
+TRACE(eliminate) \
+TRACE(focused) \
+TRACE(probe) \
+TRACE(reduce) \
+TRACE(rephase) \
+TRACE(restart) \
+TRACE(share) \
+TRACE(stable) \
+TRACE(walking) \
+
+// Hardware performance counters opened through 'perf_event_open' on Linux
+// if the 'profilecounters' option is set and read with 'rdpmc' on x86.
+
+#define PERF_COUNTERS \
+PERF_COUNTER(cycles,CPU_CYCLES) \
+PERF_COUNTER(instructions,INSTRUCTIONS) \
+PERF_COUNTER(cache_misses,CACHE_MISSES) \
+PERF_COUNTER(branch_misses,BRANCH_MISSES) \
+
+enum perf_counter
+{
+#define PERF_COUNTER(NAME,CONFIG) \
+  PERF_ ## NAME,
+  PERF_COUNTERS
+#undef PERF_COUNTER
+  SIZE_PERF_COUNTERS
+};
+
 struct profile
 {
   int level;
+  bool traced;
   const char *name;
   double entered;
   double time;
+  uint64_t entered_counters[SIZE_PERF_COUNTERS];
+  uint64_t counters[SIZE_PERF_COUNTERS];
 };
 
 struct profiles
@@ -62,11 +104,17 @@ struct profiles
   PROFS
 #undef PROF
   STACK (profile *) stack;
+  int perf;
+  double offset;
+  int descriptors[SIZE_PERF_COUNTERS];
+  void *pages[SIZE_PERF_COUNTERS];
+  uint64_t counters[SIZE_PERF_COUNTERS];
 };
 
 struct kissat;
 
 void kissat_init_profiles (profiles *);
+void kissat_release_profiles (struct kissat *);
 void kissat_profiles_print (struct kissat *);
 void kissat_start (struct kissat *, profile *);
 void kissat_stop (struct kissat *, profile *);
@@ -83,11 +131,13 @@ do { \
   profile * profile = &PROFILE (NAME); \
   if (GET_OPTION (profile) >= profile->level) \
     kissat_start (solver, profile); \
+  TRACE_PROFILE ('B', profile); \
 } while (0)
 
 #define STOP(NAME) \
 do { \
   profile * profile = &PROFILE (NAME); \
+  TRACE_PROFILE ('E', profile); \
   if (GET_OPTION (profile) >= profile->level) \
     kissat_stop (solver, profile); \
 } while (0)
@@ -96,10 +146,12 @@ do { \
 do { \
   if (GET_OPTION (profile) >= PROFILE (search).level) \
     kissat_stop_search_and_start_simplifier (solver, &PROFILE (NAME)); \
+  TRACE_PROFILE ('B', &PROFILE (NAME)); \
 } while (0)
 
 #define STOP_SIMPLIFIER_AND_RESUME_SEARCH(NAME) \
 do { \
+  TRACE_PROFILE ('E', &PROFILE (NAME)); \
   if (GET_OPTION (profile) >= PROFILE (search).level) \
     kissat_stop_simplifier_and_resume_search (solver, &PROFILE (NAME)); \
 } while (0)
@@ -142,11 +142,42 @@ sort_reducibles (kissat * solver, reducibles * reds)
   RADIX_STACK (reducible, uint64_t, *reds, USEFULNESS);
 }
 
+// Sorting all reducible clauses is not necessary, since only the set of
+// clauses reduced matters.  We count reducible clauses per glue bucket
+// first, reduce all clauses in buckets with larger glue than the bucket
+// in which the target is reached directly and only sort this boundary
+// bucket.  Sorting is stable and thus the same clauses are reduced as if
+// all reducible clauses were sorted, but the size of the sorted stack is
+// usually only a fraction of all reducible clauses.
+
+#define GLUE_BUCKETS 256
+
+static unsigned
+glue_bucket (const reducible * red)
+{
+  const unsigned glue = ~(unsigned) (red->rank >> 32);
+  return MIN (glue, GLUE_BUCKETS - 1);
+}
+
+static void
+reduce_clause (kissat * solver, ward * arena, const reducible * red)
+{
+  clause *c = (clause *) (arena + red->ref);
+  assert (kissat_clause_in_arena (solver, c));
+  assert (!c->garbage);
+  assert (!c->keep);
+  assert (!c->reason);
+  assert (c->redundant);
+  LOGCLS (c, "reducing");
+  kissat_mark_clause_as_garbage (solver, c);
+}
+
 static void
-mark_less_useful_clauses_as_garbage (kissat * solver, reducibles * reds)
+mark_less_useful_clauses_as_garbage (kissat * solver, reducibles * reds,
+				     unsigned fraction)
 {
   const size_t size = SIZE_STACK (*reds);
-  size_t target = size * (GET_OPTION (reducefraction) / 100.0);
+  size_t target = size * (fraction / 100.0);
 #ifndef QUIET
   statistics *statistics = &solver->statistics;
   const size_t clauses =
@@ -158,31 +189,63 @@ mark_less_useful_clauses_as_garbage (kissat * solver, reducibles * reds)
 		target, kissat_percent (target, size),
 		size, kissat_percent (size, clauses));
 #endif
+  if (!target)
+    return;
+  reducible *const begin = BEGIN_STACK (*reds);
+  const reducible *const end = END_STACK (*reds);
+  size_t count[GLUE_BUCKETS];
+  memset (count, 0, sizeof count);
+  for (const reducible * p = begin; p != end; p++)
+    count[glue_bucket (p)]++;
+  unsigned boundary = GLUE_BUCKETS;
+  size_t above = 0;
+  while (boundary--)
+    {
+      const size_t next = above + count[boundary];
+      if (next >= target)
+	break;
+      above = next;
+    }
+  assert (boundary < GLUE_BUCKETS);
+  LOG ("reducing %zu clauses in glue buckets above %u", above, boundary);
   unsigned reduced = 0;
   ward *arena = BEGIN_STACK (solver->arena);
-  const reducible *const begin = BEGIN_STACK (*reds);
-  const reducible *const end = END_STACK (*reds);
-  for (const reducible * p = begin; p != end && target--; p++)
+  reducible *q = begin;
+  for (const reducible * p = begin; p != end; p++)
     {
-      clause *c = (clause *) (arena + p->ref);
-      assert (kissat_clause_in_arena (solver, c));
-      assert (!c->garbage);
-      assert (!c->keep);
-      assert (!c->reason);
-      assert (c->redundant);
-      LOGCLS (c, "reducing");
-      kissat_mark_clause_as_garbage (solver, c);
+      const unsigned bucket = glue_bucket (p);
+      if (bucket > boundary)
+	{
+	  reduce_clause (solver, arena, p);
+	  reduced++;
+	}
+      else if (bucket == boundary)
+	*q++ = *p;
+    }
+  assert (reduced == above);
+  SET_END_OF_STACK (*reds, q);
+  sort_reducibles (solver, reds);
+  target -= above;
+  assert (target <= SIZE_STACK (*reds));
+  for (const reducible * p = begin; p != q && target--; p++)
+    {
+      reduce_clause (solver, arena, p);
       reduced++;
     }
   ADD (clauses_reduced, reduced);
 }
 
 static bool
-compacting (kissat * solver)
+compacting (kissat * solver, bool memory)
 {
   if (!GET_OPTION (compact))
     return false;
   unsigned inactive = solver->vars - solver->active;
+  if (memory)
+    {
+      LOG ("%u inactive variables to save memory", inactive);
+      return inactive > 0;
+    }
   unsigned limit = GET_OPTION (compactlim) / 1e2 * solver->vars;
   bool compact = (inactive > limit);
   LOG ("%u inactive variables %.0f%% <= limit %u %.0f%%",
@@ -202,16 +265,22 @@ force_restart_before_reduction (kissat * solver)
   kissat_restart_and_flush_trail (solver);
 }
 
-int
-kissat_reduce (kissat * solver)
+static int
+reduce (kissat * solver, unsigned fraction, bool memory)
 {
   START (reduce);
   INC (reductions);
-  kissat_phase (solver, "reduce", GET (reductions),
-		"reduce limit %" PRIu64 " hit after %" PRIu64
-		" conflicts", solver->limits.reduce.conflicts, CONFLICTS);
+  if (memory)
+    kissat_phase (solver, "reduce", GET (reductions),
+		  "early reduction %" PRIu64 " to save memory "
+		  "after %" PRIu64 " conflicts",
+		  GET (memory_reductions), CONFLICTS);
+  else
+    kissat_phase (solver, "reduce", GET (reductions),
+		  "reduce limit %" PRIu64 " hit after %" PRIu64
+		  " conflicts", solver->limits.reduce.conflicts, CONFLICTS);
   force_restart_before_reduction (solver);
-  bool compact = compacting (solver);
+  bool compact = compacting (solver, memory);
   reference start = compact ? 0 : solver->first_reducible;
   if (start != INVALID_REF)
     {
@@ -233,8 +302,7 @@ kissat_reduce (kissat * solver)
 	  INIT_STACK (reds);
 	  if (collect_reducibles (solver, &reds, start))
 	    {
-	      sort_reducibles (solver, &reds);
-	      mark_less_useful_clauses_as_garbage (solver, &reds);
+	      mark_less_useful_clauses_as_garbage (solver, &reds, fraction);
 	      RELEASE_STACK (reds);
 	      kissat_sparse_collect (solver, compact, start);
 	    }
@@ -253,3 +321,19 @@ kissat_reduce (kissat * solver)
   STOP (reduce);
   return solver->inconsistent ? 20 : 0;
 }
+
+int
+kissat_reduce (kissat * solver)
+{
+  return reduce (solver, GET_OPTION (reducefraction), false);
+}
+
+// Triggered by 'kissat_degrade' if allocated memory gets close to the
+// memory limit.  Reduces more clauses and compacts if possible.
+
+int
+kissat_reduce_memory (kissat * solver)
+{
+  INC (memory_reductions);
+  return reduce (solver, GET_OPTION (degradefraction), true);
+}
@@ -7,5 +7,6 @@ struct kissat;
 
 bool kissat_reducing (struct kissat *);
 int kissat_reduce (struct kissat *);
+int kissat_reduce_memory (struct kissat *);
 
 #endif
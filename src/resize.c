@@ -67,7 +67,9 @@ kissat_increase_size (kissat * solver, unsigned new_size)
 
   CREALLOC_LITERAL_INDEXED (mark, marks);
   CREALLOC_LITERAL_INDEXED (value, values);
+  START_MEMORY (watches);
   CREALLOC_LITERAL_INDEXED (watches, watches);
+  STOP_MEMORY (watches);
 
   reallocate_trail (solver, old_size, new_size);
 
@@ -99,7 +101,9 @@ kissat_decrease_size (kissat * solver)
 
   NREALLOC_LITERAL_INDEXED (mark, marks);
   NREALLOC_LITERAL_INDEXED (value, values);
+  START_MEMORY (watches);
   NREALLOC_LITERAL_INDEXED (watches, watches);
+  STOP_MEMORY (watches);
 
   reallocate_trail (solver, old_size, new_size);
 
@@ -11,17 +11,9 @@ kissat_wall_clock_time (void)
   return 1e-6 * tv.tv_usec + tv.tv_sec;
 }
 
-#ifndef QUIET
+#if !defined(QUIET) || defined(COUNTERS)
 
-#include "internal.h"
-#include "statistics.h"
-#include "utilities.h"
-
-#include <stdio.h>
-#include <inttypes.h>
 #include <sys/resource.h>
-#include <sys/types.h>
-#include <unistd.h>
 
 double
 kissat_process_time (void)
@@ -35,6 +27,19 @@ kissat_process_time (void)
   return res;
 }
 
+#endif
+
+#ifndef QUIET
+
+#include "internal.h"
+#include "statistics.h"
+#include "utilities.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <sys/types.h>
+#include <unistd.h>
+
 uint64_t
 kissat_maximum_resident_set_size (void)
 {
@@ -83,7 +88,32 @@ kissat_print_resources (kissat * solver)
 	  "max-allocated:",
 	  max_allocated, "bytes", kissat_percent (max_allocated, rss));
 #endif
+  const memory *memory = &solver->memory;
+  printf ("c "
+	  "%-" SFW1 "s "
+	  "%" SFW2 PRIu64 " "
+	  "%-" SFW3 "s "
+	  "%" SFW4 ".0f "
+	  "MB\n",
+	  "peak-memory:", memory->peak, "bytes",
+	  memory->peak / (double) (1 << 20));
+  for (unsigned i = 0; i < SIZE_MEMORY_CATEGORIES; i++)
+    {
+      const uint64_t peak = memory->maximum[i];
+      if (!peak)
+	continue;
+      char name[32];
+      sprintf (name, "peak-memory-%s:", kissat_memory_category_names[i]);
+      printf ("c "
+	      "%-" SFW1 "s "
+	      "%" SFW2 PRIu64 " "
+	      "%-" SFW3 "s "
+	      "%" SFW4 ".0f "
+	      "%%\n", name, peak, "bytes", kissat_percent (peak, memory->peak));
+    }
   printf ("c process-time: %30s %18.2f seconds\n", FORMAT_TIME (t), t);
+  if (solver->collect_pause > 0)
+    printf ("c max-collect-pause: %44.2f seconds\n", solver->collect_pause);
   fflush (stdout);
 }
 
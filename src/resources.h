@@ -3,6 +3,10 @@
 
 double kissat_wall_clock_time (void);
 
+#if !defined(QUIET) || defined(COUNTERS)
+double kissat_process_time (void);
+#endif
+
 #ifndef QUIET
 
 #ifndef _resources_h_INLCUDED
@@ -12,7 +16,6 @@ double kissat_wall_clock_time (void);
 
 struct kissat;
 
-double kissat_process_time (void);
 uint64_t kissat_current_resident_set_size (void);
 uint64_t kissat_maximum_resident_set_size (void);
 void kissat_print_resources (struct kissat *);
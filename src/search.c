@@ -1,13 +1,16 @@
 #include "analyze.h"
 #include "bump.h"
 #include "decide.h"
+#include "degrade.h"
 #include "eliminate.h"
+#include "gauss.h"
 #include "internal.h"
 #include "logging.h"
 #include "print.h"
 #include "probe.h"
 #include "propsearch.h"
 #include "search.h"
+#include "share.h"
 #include "reduce.h"
 #include "reluctant.h"
 #include "report.h"
@@ -20,13 +23,8 @@
 #include <inttypes.h>
 
 static void
-start_search (kissat * solver)
+init_search (kissat * solver)
 {
-  START (search);
-  INC (searches);
-
-  REPORT (0, '*');
-
   bool stable = (GET_OPTION (stable) == 2);
 
   solver->stable = stable;
@@ -48,6 +46,28 @@ start_search (kissat * solver)
   const unsigned eagersubsume = GET_OPTION (eagersubsume);
   if (eagersubsume && !solver->clueue.elements)
     kissat_init_clueue (solver, &solver->clueue, eagersubsume);
+
+  kissat_init_gauss (solver);
+}
+
+// A search interrupted by a limit or termination is resumed where it
+// stopped, i.e., without resetting search state, limits and mode, and
+// follows the same trajectory as if it would not have been interrupted.
+
+static void
+start_search (kissat * solver)
+{
+  START (search);
+  INC (searches);
+
+  REPORT (0, '*');
+
+  if (GET (searches) == 1)
+    init_search (solver);
+  else
+    kissat_phase (solver, "search", GET (searches),
+		  "resuming %s search after %" PRIu64 " conflicts",
+		  (solver->stable ? "stable" : "focus"), CONFLICTS);
 #ifndef QUIET
   limits *limits = &solver->limits;
   limited *limited = &solver->limited;
@@ -66,7 +86,11 @@ start_search (kissat * solver)
 			 "starting search with decisions limited to %" PRIu64
 			 " and conflicts limited to %" PRIu64,
 			 limits->decisions, limits->conflicts);
-  if (stable)
+  if (limited->ticks)
+    kissat_very_verbose (solver,
+			 "ticks limited to %" PRIu64, limits->ticks);
+#endif
+  if (solver->stable)
     {
       START (stable);
       REPORT (0, '[');
@@ -76,7 +100,6 @@ start_search (kissat * solver)
       START (focused);
       REPORT (0, '{');
     }
-#endif
 }
 
 static void
@@ -94,25 +117,30 @@ stop_search (kissat * solver, int res)
       solver->limited.decisions = false;
     }
 
+  if (solver->limited.ticks)
+    {
+      LOG ("reset ticks limit");
+      solver->limited.ticks = false;
+    }
+
   if (solver->termination.flagged)
     {
       kissat_very_verbose (solver, "termination forced externally");
       solver->termination.flagged = 0;
     }
 
-#ifndef QUIET
   LOG ("search result %d", res);
   if (solver->stable)
     {
       REPORT (0, ']');
       STOP (stable);
-      solver->stable = false;
     }
   else
     {
       REPORT (0, '}');
       STOP (focused);
     }
+#ifndef QUIET
   char type = (res == 10 ? '1' : res == 20 ? '0' : '?');
   REPORT (0, type);
 #else
@@ -144,6 +172,20 @@ conflict_limit_hit (kissat * solver)
   return true;
 }
 
+static bool
+ticks_limit_hit (kissat * solver)
+{
+  if (!solver->limited.ticks)
+    return false;
+  const uint64_t ticks = SEARCH_AND_PROBING_TICKS;
+  if (solver->limits.ticks > ticks)
+    return false;
+  kissat_very_verbose (solver, "ticks limit %" PRIu64
+		       " hit after %" PRIu64 " ticks",
+		       solver->limits.ticks, ticks);
+  return true;
+}
+
 static bool
 decision_limit_hit (kissat * solver)
 {
@@ -162,10 +204,14 @@ int
 kissat_search (kissat * solver)
 {
   start_search (solver);
-  int res = kissat_walk_initially (solver);
+  int res = 0;
+  if (GET (searches) == 1)
+    res = kissat_walk_initially (solver);
   while (!res)
     {
       clause *conflict = kissat_search_propagate (solver);
+      if (!conflict && kissat_gaussing (solver))
+	conflict = kissat_gauss_propagate (solver);
       if (conflict)
 	res = kissat_analyze (solver, conflict);
       else if (solver->iterating)
@@ -176,6 +222,12 @@ kissat_search (kissat * solver)
 	break;
       else if (conflict_limit_hit (solver))
 	break;
+      else if (ticks_limit_hit (solver))
+	break;
+      else if (kissat_memory_limit_hit (solver))
+	break;
+      else if (kissat_degrading (solver))
+	res = kissat_degrade (solver);
       else if (kissat_reducing (solver))
 	res = kissat_reduce (solver);
       else if (kissat_switching_search_mode (solver))
@@ -188,6 +240,8 @@ kissat_search (kissat * solver)
 	res = kissat_eliminate (solver);
       else if (kissat_probing (solver))
 	res = kissat_probe (solver);
+      else if (kissat_sharing (solver))
+	kissat_share (solver);
       else if (kissat_importing_redundant_clauses (solver))
   kissat_import_redundant_clauses (solver);
       else if (decision_limit_hit (solver))
@@ -0,0 +1,201 @@
+#include "backtrack.h"
+#include "degrade.h"
+#include "inline.h"
+#include "print.h"
+#include "share.h"
+#include "sort.h"
+#include "trace.h"
+#include "clauseimport.h"
+
+#include <inttypes.h>
+
+static uint64_t
+current_epoch (kissat * solver, unsigned length)
+{
+  assert (length);
+  return SEARCH_AND_PROBING_TICKS / length;
+}
+
+bool
+kissat_sharing (kissat * solver)
+{
+  const unsigned length = GET_OPTION (shareepoch);
+  if (!length)
+    return false;
+  if (!solver->consume_clause && !solver->produce_clause)
+    return false;
+  return current_epoch (solver, length) > solver->share.epoch;
+}
+
+void
+kissat_defer_export (kissat * solver, unsigned glue)
+{
+  ints *exported = &solver->share.exported;
+  PUSH_STACK (*exported, (int) SIZE_STACK (solver->clause));
+  PUSH_STACK (*exported, (int) glue);
+  for (all_stack (unsigned, ilit, solver->clause))
+    PUSH_STACK (*exported, kissat_export_literal (solver, ilit));
+}
+
+static void
+flush_exports (kissat * solver)
+{
+  ints *exported = &solver->share.exported;
+  TRACE_BEGIN ("export");
+#if !defined(QUIET) || defined(COUNTERS)
+  const unsigned long exported_before = solver->num_exported_clauses;
+#endif
+  int *buffer = solver->consume_clause_buffer;
+  const int *p = BEGIN_STACK (*exported);
+  const int *const end = END_STACK (*exported);
+  while (p != end)
+    {
+      const int size = *p++;
+      const int glue = *p++;
+      for (int i = 0; i < size; i++)
+	buffer[i] = *p++;
+      solver->consume_clause (solver->consume_clause_state, size, glue);
+      solver->num_exported_clauses++;
+    }
+  TRACE_END ("export", solver->num_exported_clauses - exported_before);
+  CLEAR_STACK (*exported);
+}
+
+static void
+collect_imports (kissat * solver)
+{
+  ints *imported = &solver->share.imported;
+  unsigneds *clauses = &solver->share.clauses;
+  assert (EMPTY_STACK (*imported));
+  assert (EMPTY_STACK (*clauses));
+  for (;;)
+    {
+      int *buffer = 0, size = 0, glue = 0;
+      solver->produce_clause (solver->produce_clause_state,
+			      &buffer, &size, &glue);
+      if (size <= 0 || !buffer)
+	break;
+      PUSH_STACK (*clauses, SIZE_STACK (*imported));
+      PUSH_STACK (*imported, size);
+      PUSH_STACK (*imported, glue);
+      for (int i = 0; i < size; i++)
+	PUSH_STACK (*imported, buffer[i]);
+      int *lits = END_STACK (*imported) - size;
+#define LESS_LITERAL(A,B) ((A) < (B))
+      SORT (int, size, lits, LESS_LITERAL);
+    }
+}
+
+// Order records by size, then literals and finally glue.
+
+static inline bool
+less_imported (const int *imported, unsigned a, unsigned b)
+{
+  const int *c = imported + a, *d = imported + b;
+  const int size = c[0];
+  if (size != d[0])
+    return size < d[0];
+  for (int i = 2; i < size + 2; i++)
+    if (c[i] != d[i])
+      return c[i] < d[i];
+  return c[1] < d[1];
+}
+
+static bool
+same_literals (const int *c, const int *d)
+{
+  const int size = c[0];
+  if (size != d[0])
+    return false;
+  for (int i = 2; i < size + 2; i++)
+    if (c[i] != d[i])
+      return false;
+  return true;
+}
+
+// After sorting, duplicates are adjacent and the copy with the smallest
+// glue comes first and is kept.
+
+static void
+sort_and_deduplicate_imports (kissat * solver)
+{
+  ints *imported = &solver->share.imported;
+  unsigneds *clauses = &solver->share.clauses;
+  const int *begin = BEGIN_STACK (*imported);
+#define LESS_IMPORTED(A,B) less_imported (begin, (A), (B))
+  SORT_STACK (unsigned, *clauses, LESS_IMPORTED);
+  unsigned *q = BEGIN_STACK (*clauses);
+  const unsigned *const end = END_STACK (*clauses);
+  const int *last = 0;
+  for (const unsigned *p = q; p != end; p++)
+    {
+      const int *c = begin + *p;
+      if (last && same_literals (last, c))
+	{
+	  INC (share_duplicated);
+	  continue;
+	}
+      *q++ = *p;
+      last = c;
+    }
+  SET_END_OF_STACK (*clauses, q);
+}
+
+static void
+import_canonically (kissat * solver)
+{
+  collect_imports (solver);
+  sort_and_deduplicate_imports (solver);
+  ints *imported = &solver->share.imported;
+  int *begin = BEGIN_STACK (*imported);
+  for (all_stack (unsigned, offset, solver->share.clauses))
+    {
+      int *c = begin + offset;
+      kissat_import_redundant_clause (solver, c + 2, c[0], c[1]);
+    }
+  CLEAR_STACK (solver->share.clauses);
+  CLEAR_STACK (*imported);
+}
+
+void
+kissat_share (kissat * solver)
+{
+  START (share);
+  share *share = &solver->share;
+  const uint64_t epoch = current_epoch (solver, GET_OPTION (shareepoch));
+  assert (epoch > share->epoch);
+  share->epoch = epoch;
+  INC (share_epochs);
+#ifndef QUIET
+  const unsigned long exported_before = solver->num_exported_clauses;
+  const unsigned long imported_before =
+    solver->num_imported_external_clauses;
+#endif
+  if (solver->level)
+    kissat_backtrack_in_consistent_state (solver, 0);
+  if (solver->consume_clause)
+    flush_exports (solver);
+  if (share->barrier)
+    share->barrier (share->state, epoch);
+  if (solver->produce_clause &&
+      solver->memory.degraded < DEGRADED_ISOLATED)
+    import_canonically (solver);
+  kissat_extremely_verbose (solver,
+			    "epoch %" PRIu64 " exported %lu and imported %lu "
+			    "clauses", epoch,
+			    solver->num_exported_clauses - exported_before,
+			    solver->num_imported_external_clauses -
+			    imported_before);
+  TRACE_COUNTER ("exported", solver->num_exported_clauses);
+  TRACE_COUNTER ("imported", solver->num_imported_external_clauses);
+  STOP (share);
+}
+
+void
+kissat_release_share (kissat * solver)
+{
+  share *share = &solver->share;
+  RELEASE_STACK (share->exported);
+  RELEASE_STACK (share->imported);
+  RELEASE_STACK (share->clauses);
+}
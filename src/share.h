@@ -0,0 +1,37 @@
+#ifndef _share_h_INCLUDED
+#define _share_h_INCLUDED
+
+#include "stack.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Deterministic clause sharing ('shareepoch' non-zero) exchanges clauses
+// only at the boundaries of epochs of 'shareepoch' search and probing
+// ticks.  Learned clauses are buffered in 'exported' as records of size,
+// glue and external literals and flushed through the export callback at
+// the next epoch, then the host's barrier is called and finally all
+// clauses produced by the import callback are collected in 'imported'
+// (same record format, 'clauses' holding their offsets) and imported in a
+// canonical order independent of the order in which they were produced.
+
+typedef struct share share;
+
+struct share
+{
+  uint64_t epoch;
+  ints exported;
+  ints imported;
+  unsigneds clauses;
+  void *state;
+  void (*barrier) (void *state, unsigned long epoch);
+};
+
+struct kissat;
+
+bool kissat_sharing (struct kissat *);
+void kissat_share (struct kissat *);
+void kissat_defer_export (struct kissat *, unsigned glue);
+void kissat_release_share (struct kissat *);
+
+#endif
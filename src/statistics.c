@@ -93,6 +93,9 @@ kissat_statistics_print (kissat * solver, bool verbose)
 #define PER_SECOND(NAME) \
   kissat_average (statistics->NAME, time)
 
+#define PER_SWEEP_SOLVED(NAME) \
+  RELATIVE (NAME, sweep_solved)
+
 #ifndef METRICS
 #define PER_TRN_RESOLVED(NAME) \
   -1
@@ -194,6 +197,9 @@ kissat_statistics_print (kissat * solver, bool verbose)
 #define PCNT_SUBSUMPTION_CHECK(NAME) \
   PERCENT (NAME, subsumption_checks)
 
+#define PCNT_SWEEP_FLIP_BACKBONE(NAME) \
+  PERCENT (NAME, sweep_flip_backbone)
+
 #define PCNT_SWEEP_SOLVED(NAME) \
   PERCENT (NAME, sweep_solved)
 
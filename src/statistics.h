@@ -88,6 +88,10 @@ METRIC( garbage_collections, 2, CONF_INT, "", "interval") \
 METRIC( gates_checked, 1, PCNT_ELIM_ATTEMPTS, "%", "attempts") \
 METRIC( gates_eliminated, 1, PCNT_ELIMINATED, "%", "eliminated") \
 METRIC( gates_extracted, 1, PCNT_ELIM_ATTEMPTS, "%", "attempts") \
+COUNTER( gauss_conflicts, 1, PCNT_CONFLICTS, "%", "conflicts") \
+COUNTER( gauss_extracted, 1, NO_SECONDARY, 0, 0) \
+COUNTER( gauss_propagations, 1, PCNT_PROPS, "%", "propagations") \
+COUNTER( gauss_rebuilds, 1, CONF_INT, "", "interval") \
 METRIC( hyper_binaries, 2, PCNT_REDUNDANT_CLAUSES, "%", "redundant") \
 METRIC( hyper_binary_resolved, 1, NO_SECONDARY, 0, 0) \
 METRIC( hyper_propagations, 2, PCNT_PROPS, "%", "propagations") \
@@ -117,6 +121,10 @@ COUNTER ( literals_learned, 0, PER_CLS_LEARNED, 0, "per clause") \
 COUNTER ( literals_minimized, 0, PCNT_LITS_DEDUCED, "%", "deduced") \
 COUNTER ( literals_minimize_shrunken, 0, PCNT_LITS_SHRUNKEN, "%", "shrunken") \
 COUNTER ( literals_shrunken, 0, PCNT_LITS_DEDUCED, "%", "deduced") \
+COUNTER( memory_isolated, 1, NO_SECONDARY, 0, 0) \
+COUNTER( memory_limit_hits, 1, NO_SECONDARY, 0, 0) \
+COUNTER( memory_reductions, 1, PCNT_REDUCTIONS, "%", "reductions") \
+COUNTER( memory_shrunken, 1, NO_SECONDARY, 0, 0) \
 METRIC( moved, 1, PCNT_REDUCTIONS, "%", "reductions") \
 METRIC( on_the_fly_strengthened, 1, PCNT_CONFLICTS, "%", "of conflicts") \
 METRIC( on_the_fly_subsumed, 1, PCNT_CONFLICTS, "%", "of conflicts") \
@@ -138,6 +146,9 @@ METRIC( saved_decisions, 1, PCNT_DECISIONS, "%", "decisions") \
 COUNTER( searches, 2, CONF_INT, "", "interval") \
 METRIC( search_propagations, 2, PCNT_PROPS, "%", "propagations") \
 COUNTER( search_ticks, 2, PCNT_TICKS, "%", "ticks") \
+METRIC( segregated, 1, PCNT_COLLECTIONS, "%", "collections") \
+COUNTER( share_duplicated, 2, NO_SECONDARY, 0, 0) \
+COUNTER( share_epochs, 1, CONF_INT, "", "interval") \
 METRIC( sparse_garbage_collections, 2, PCNT_COLLECTIONS, "%", "collections") \
 METRIC( stable_decisions, 1, PCNT_DECISIONS, "%", "decisions") \
 METRIC( stable_modes, 2, CONF_INT, "", "interval") \
@@ -154,6 +165,8 @@ COUNTER( subsumed, 1, PCNT_SUBSUMPTION_CHECK, "%", "checks") \
 COUNTER( sweep, 1, CONF_INT, "", "interval") \
 COUNTER( sweep_completed, 0, SWEEPS_PER_COMPLETED, "", "sweeps") \
 COUNTER( sweep_equivalences, 0, PCNT_VARIABLES, "", "variables") \
+COUNTER( sweep_flip_backbone, 0, PER_SWEEP_SOLVED, "", "per sweep_solved") \
+COUNTER( sweep_flipped_backbone, 0, PCNT_SWEEP_FLIP_BACKBONE, "%", "sweep_flip_backbone") \
 COUNTER( sweep_sat, 0, PCNT_SWEEP_SOLVED, "%", "sweep_solved") \
 COUNTER( sweep_solved, 0, PCNT_KITTEN_SOLVED, "%", "kitten_solved") \
 COUNTER( sweep_units, 0, PCNT_VARIABLES, "%", "variables") \
@@ -175,6 +188,7 @@ COUNTER( variables_added, 2, PER_VARIABLE, 0, "per variable") \
 COUNTER( variables_removed, 2, PER_VARIABLE, 0, "variables") \
 METRIC( vectors_defrags_needed, 1, PCNT_DEFRAGS, "%", "defrags") \
 METRIC( vectors_enlarged, 2, CONF_INT, "", "interval") \
+METRIC( vectors_reused, 2, CONF_INT, "", "interval") \
 STATISTIC( vivifications, 2, CONF_INT, "", "interval") \
 METRIC( vivified, 1, PCNT_VIVIFY_CHECK, "%", "checks") \
 STATISTIC( vivify_checks, 2, PER_VIVIFICATION, "", "per vivify") \
@@ -249,6 +263,9 @@ struct statistics
 #define LEARNED_CLAUSES (solver->statistics.learned)
 #define REDUNDANT_CLAUSES (solver->statistics.clauses_redundant)
 
+#define SEARCH_AND_PROBING_TICKS \
+  (solver->statistics.search_ticks + solver->statistics.probing_ticks)
+
 /*------------------------------------------------------------------------*/
 
 #define COUNTER(NAME,VERBOSE,OTHER,UNITS,TYPE) \
@@ -1,3 +1,4 @@
+#include "degrade.h"
 #include "dense.h"
 #include "inline.h"
 #include "logging.h"
@@ -546,6 +547,30 @@ sweep_refine (kissat * solver, sweeper * sweeper)
     sweep_refine_partition (solver, sweeper);
 }
 
+static void
+flip_backbone_candidates (kissat * solver, sweeper * sweeper)
+{
+  if (!GET_OPTION (sweepflip))
+    return;
+  LOG ("flipping backbone candidates");
+  kitten *kitten = solver->kitten;
+  unsigned *q = BEGIN_STACK (sweeper->backbone);
+  const unsigned *const end = END_STACK (sweeper->backbone), *p = q;
+  while (p != end)
+    {
+      const unsigned lit = *p++;
+      INC (sweep_flip_backbone);
+      if (kitten_flip_literal (kitten, lit))
+	{
+	  LOG ("flipped backbone candidate %s", LOGLIT (lit));
+	  INC (sweep_flipped_backbone);
+	}
+      else
+	*q++ = lit;
+    }
+  SET_END_OF_STACK (sweeper->backbone, q);
+}
+
 static void
 sweep_backbone_candidate (kissat * solver, sweeper * sweeper, unsigned lit)
 {
@@ -558,6 +583,7 @@ sweep_backbone_candidate (kissat * solver, sweeper * sweeper, unsigned lit)
     {
       LOG ("sweeping backbone candidate %s failed", LOGLIT (lit));
       sweep_refine (solver, sweeper);
+      flip_backbone_candidates (solver, sweeper);
     }
   else if (res == 20)
     {
@@ -766,6 +792,7 @@ sweep_variable (kissat * solver, sweeper * sweeper, unsigned idx)
   if (res == 10)
     {
       init_backbone_and_partition (solver, sweeper);
+      flip_backbone_candidates (solver, sweeper);
 #ifndef QUIET
       uint64_t units = solver->statistics.sweep_units;
       uint64_t solved = solver->statistics.sweep_solved;
@@ -967,6 +994,8 @@ kissat_sweep (kissat * solver)
 {
   if (!GET_OPTION (sweep))
     return;
+  if (solver->memory.degraded >= DEGRADED_SHRUNKEN)
+    return;
   if (solver->inconsistent)
     return;
   assert (!solver->level);
@@ -0,0 +1,125 @@
+#if !defined(QUIET) || defined(COUNTERS)
+
+#include "allocate.h"
+#include "internal.h"
+#include "print.h"
+#include "resources.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+void
+kissat_init_trace (kissat * solver)
+{
+  trace *trace = &solver->trace;
+  if (trace->events)
+    return;
+  const size_t size = GET_OPTION (traceevents);
+  if (!size)
+    return;
+  CALLOC (trace->events, size);
+  trace->size = size;
+  kissat_very_verbose (solver,
+		       "allocated trace ring buffer of %zu events", size);
+}
+
+void
+kissat_trace_event (kissat * solver, char phase,
+		    const char *name, uint64_t arg)
+{
+  trace *trace = &solver->trace;
+  assert (trace->events);
+  assert (trace->head < trace->size);
+  trace_event *event = trace->events + trace->head;
+  event->name = name;
+  event->time = kissat_wall_clock_time ();
+  event->conflicts = CONFLICTS;
+  event->decisions = DECISIONS;
+  event->propagations = solver->statistics.propagations;
+  event->arg = arg;
+  event->phase = phase;
+  if (++trace->head == trace->size)
+    trace->head = 0;
+  trace->recorded++;
+}
+
+static void
+write_event (FILE * file, const trace_event * event, uint64_t pid)
+{
+  fprintf (file,
+	   "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.0f,"
+	   "\"pid\":%" PRIu64 ",\"tid\":0,\"args\":{",
+	   event->name, event->phase, 1e6 * event->time, pid);
+  if (event->phase == 'C')
+    fprintf (file, "\"%s\":%" PRIu64, event->name, event->arg);
+  else
+    {
+      fprintf (file,
+	       "\"conflicts\":%" PRIu64 ",\"decisions\":%" PRIu64
+	       ",\"propagations\":%" PRIu64,
+	       event->conflicts, event->decisions, event->propagations);
+      if (event->phase == 'E')
+	fprintf (file, ",\"count\":%" PRIu64, event->arg);
+    }
+  fputs ("}}", file);
+}
+
+// If the ring buffer overflowed the oldest remaining events might include
+// end events without matching begin event, which are skipped.  Begin events
+// without end event are kept and extended to the end of the trace.
+
+bool
+kissat_write_trace_to_file (kissat * solver, const char *path)
+{
+  FILE *file = fopen (path, "w");
+  if (!file)
+    return false;
+  trace *trace = &solver->trace;
+  const uint64_t pid = getpid ();
+  size_t size, start;
+  if (trace->recorded < trace->size)
+    size = trace->recorded, start = 0;
+  else
+    size = trace->size, start = trace->head;
+  fputs ("{\"traceEvents\":[\n", file);
+  unsigned depth = 0;
+  bool first = true;
+  for (size_t i = 0; i < size; i++)
+    {
+      size_t pos = start + i;
+      if (pos >= trace->size)
+	pos -= trace->size;
+      const trace_event *event = trace->events + pos;
+      if (event->phase == 'B')
+	depth++;
+      else if (event->phase == 'E')
+	{
+	  if (!depth)
+	    continue;
+	  depth--;
+	}
+      if (!first)
+	fputs (",\n", file);
+      write_event (file, event, pid);
+      first = false;
+    }
+  fputs ("\n],\"displayTimeUnit\":\"ms\"}\n", file);
+  const bool res = !ferror (file);
+  if (fclose (file))
+    return false;
+  return res;
+}
+
+void
+kissat_release_trace (kissat * solver)
+{
+  trace *trace = &solver->trace;
+  DEALLOC (trace->events, trace->size);
+  trace->events = 0;
+  trace->size = trace->head = trace->recorded = 0;
+}
+
+#else
+int kissat_trace_dummy_to_avoid_warning;
+#endif
@@ -0,0 +1,69 @@
+#ifndef _trace_h_INCLUDED
+#define _trace_h_INCLUDED
+
+#if !defined(QUIET) || defined(COUNTERS)
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Events are recorded into a ring buffer of 'traceevents' entries which is
+// allocated when solving starts, such that recording itself never needs to
+// allocate memory.  If the buffer is full the oldest events are overwritten.  The buffer can be written in the Chrome trace event
+// format (JSON) to be viewed with 'chrome://tracing' or 'ui.perfetto.dev'.
+
+typedef struct trace trace;
+typedef struct trace_event trace_event;
+
+struct trace_event
+{
+  const char *name;
+  double time;
+  uint64_t conflicts;
+  uint64_t decisions;
+  uint64_t propagations;
+  uint64_t arg;
+  char phase;
+};
+
+struct trace
+{
+  trace_event *events;
+  size_t size;
+  size_t head;
+  uint64_t recorded;
+};
+
+struct kissat;
+
+void kissat_init_trace (struct kissat *);
+void kissat_trace_event (struct kissat *, char phase,
+			 const char *name, uint64_t arg);
+bool kissat_write_trace_to_file (struct kissat *, const char *path);
+void kissat_release_trace (struct kissat *);
+
+#define TRACE_EVENT(PHASE,NAME,ARG) \
+do { \
+  if (solver->trace.events) \
+    kissat_trace_event (solver, (PHASE), (NAME), (ARG)); \
+} while (0)
+
+#define TRACE_BEGIN(NAME) TRACE_EVENT ('B', (NAME), 0)
+#define TRACE_END(NAME,ARG) TRACE_EVENT ('E', (NAME), (ARG))
+#define TRACE_COUNTER(NAME,ARG) TRACE_EVENT ('C', (NAME), (ARG))
+
+#define TRACE_PROFILE(PHASE,PROFILE) \
+do { \
+  if (solver->trace.events && (PROFILE)->traced) \
+    kissat_trace_event (solver, (PHASE), (PROFILE)->name, 0); \
+} while (0)
+
+#else
+
+#define TRACE_BEGIN(...) do { } while (0)
+#define TRACE_END(...) do { } while (0)
+#define TRACE_COUNTER(...) do { } while (0)
+#define TRACE_PROFILE(...) do { } while (0)
+
+#endif
+
+#endif
@@ -14,6 +14,10 @@ kissat_flush_trail (kissat * solver)
   LOG ("flushed %zu units from trail", SIZE_ARRAY (solver->trail));
   CLEAR_ARRAY (solver->trail);
   kissat_reset_propagate (solver);
+  gauss *gauss = &solver->gauss;
+  if (gauss->propagated < solver->unflushed)
+    gauss->rescan = true;
+  gauss->propagated = 0;
   solver->unflushed = 0;
 }
 
@@ -40,6 +40,73 @@ unsigned * new_unsigned_ptr_value = (unsigned *) new_char_ptr_value; \
 
 #endif
 
+// Blocks of vectors moved away by 'kissat_enlarge_vector' are kept in free
+// lists indexed by the floor of the binary logarithm of their size.  Later
+// enlargements reuse those blocks instead of appending to the stack, which
+// keeps the number of usable entries and thus defragmentations low.  Since
+// a neighboring vector might grow in place into a free block, or an empty
+// vector still pointing into it might be pushed to, blocks are validated
+// lazily by checking that all their entries are still invalid.
+
+static void
+free_vector_block (kissat * solver, unsigned *begin, size_t size)
+{
+  if (!size)
+    return;
+  const unsigned class = kissat_log2_floor_of_uint64 (size);
+  assert (class < LD_MAX_VECTORS);
+  const size_t offset = begin - BEGIN_STACK (solver->vectors.stack);
+  START_MEMORY (watches);
+  PUSH_STACK (solver->vectors.blocks[class], offset);
+  STOP_MEMORY (watches);
+}
+
+static unsigned *
+reuse_vector_block (kissat * solver, size_t size)
+{
+  const unsigned class = kissat_log2_ceiling_of_uint64 (size);
+  if (class >= LD_MAX_VECTORS)
+    return 0;
+  vectors *vectors = &solver->vectors;
+  sizes *blocks = vectors->blocks + class;
+  unsigned *const begin_stack = BEGIN_STACK (vectors->stack);
+  const size_t size_stack = SIZE_STACK (vectors->stack);
+  while (!EMPTY_STACK (*blocks))
+    {
+      const size_t offset = POP_STACK (*blocks);
+      if (size_stack - offset < size)
+	continue;
+      unsigned *const begin = begin_stack + offset;
+      const unsigned *const end = begin + size;
+      const unsigned *p = begin;
+      while (p != end && *p == INVALID_VECTOR_ELEMENT)
+	p++;
+      if (p != end)
+	continue;
+      INC (vectors_reused);
+      return begin;
+    }
+  return 0;
+}
+
+static void
+clear_vector_blocks (kissat * solver)
+{
+  for (unsigned class = 0; class < LD_MAX_VECTORS; class++)
+    CLEAR_STACK (solver->vectors.blocks[class]);
+}
+
+void
+kissat_release_vectors (kissat * solver)
+{
+  vectors *vectors = &solver->vectors;
+  START_MEMORY (watches);
+  RELEASE_STACK (vectors->stack);
+  for (unsigned class = 0; class < LD_MAX_VECTORS; class++)
+    RELEASE_STACK (vectors->blocks[class]);
+  STOP_MEMORY (watches);
+}
+
 unsigned *
 kissat_enlarge_vector (kissat * solver, vector * vector)
 {
@@ -52,17 +119,20 @@ kissat_enlarge_vector (kissat * solver, vector * vector)
 #endif
   assert (old_vector_size < MAX_VECTORS / 2);
   const size_t new_vector_size = old_vector_size ? 2 * old_vector_size : 1;
+  unsigned *begin_new_vector = reuse_vector_block (solver, new_vector_size);
+  const bool reused = (begin_new_vector != 0);
   size_t old_stack_size = SIZE_STACK (*stack);
   size_t capacity = CAPACITY_STACK (*stack);
   assert (kissat_is_power_of_two (MAX_VECTORS));
   assert (capacity <= MAX_VECTORS);
   size_t available = capacity - old_stack_size;
-  if (new_vector_size > available)
+  if (!reused && new_vector_size > available)
     {
 #if !defined(QUIET) || !defined(COMPACT)
       unsigned *old_begin_stack = BEGIN_STACK (*stack);
 #endif
       unsigned enlarged = 0;
+      START_MEMORY (watches);
       do
 	{
 	  assert (kissat_is_zero_or_power_of_two (capacity));
@@ -78,6 +148,7 @@ kissat_enlarge_vector (kissat * solver, vector * vector)
 	  available = capacity - old_stack_size;
 	}
       while (new_vector_size > available);
+      STOP_MEMORY (watches);
 
       if (enlarged)
 	{
@@ -104,21 +175,27 @@ kissat_enlarge_vector (kissat * solver, vector * vector)
       assert (new_vector_size <= available);
     }
   unsigned *begin_old_vector = kissat_begin_vector (solver, vector);
-  unsigned *begin_new_vector = END_STACK (*stack);
+  if (!reused)
+    begin_new_vector = END_STACK (*stack);
   unsigned *middle_new_vector = begin_new_vector + old_vector_size;
   unsigned *end_new_vector = begin_new_vector + new_vector_size;
   assert (end_new_vector <= stack->allocated);
   const size_t old_bytes = old_vector_size * sizeof (unsigned);
-  const size_t delta_size = new_vector_size - old_vector_size;
-  assert (MAX_SIZE_T / sizeof (unsigned) >= delta_size);
-  const size_t delta_bytes = delta_size * sizeof (unsigned);
   memcpy (begin_new_vector, begin_old_vector, old_bytes);
   memset (begin_old_vector, 0xff, old_bytes);
-  solver->vectors.usable += old_vector_size;
-  kissat_add_usable (solver, delta_size);
-  memset (middle_new_vector, 0xff, delta_bytes);
+  free_vector_block (solver, begin_old_vector, old_vector_size);
+  if (!reused)
+    {
+      const size_t delta_size = new_vector_size - old_vector_size;
+      assert (MAX_SIZE_T / sizeof (unsigned) >= delta_size);
+      const size_t delta_bytes = delta_size * sizeof (unsigned);
+      solver->vectors.usable += old_vector_size;
+      kissat_add_usable (solver, delta_size);
+      memset (middle_new_vector, 0xff, delta_bytes);
+      stack->end = end_new_vector;
+    }
 #ifdef COMPACT
-  const uint64_t offset = SIZE_STACK (*stack);
+  const uint64_t offset = begin_new_vector - BEGIN_STACK (*stack);
   assert (offset <= MAX_VECTORS);
   vector->offset = offset;
   LOG2 ("enlarged vector at %p to %u[%u]",
@@ -132,7 +209,6 @@ kissat_enlarge_vector (kissat * solver, vector * vector)
 	(void *) vector, new_offset, old_vector_size);
 #endif
 #endif
-  stack->end = end_new_vector;
   assert (begin_new_vector < end_new_vector);
   assert (kissat_size_vector (vector) == old_vector_size);
   return middle_new_vector;
@@ -231,10 +307,13 @@ kissat_defrag_vectors (kissat * solver,
   assert (freed == solver->vectors.usable);
 #endif
   SET_END_OF_STACK (*stack, p);
+  clear_vector_blocks (solver);
 #ifndef COMPACT
   assert (old_begin_stack == BEGIN_STACK (*stack));
 #endif
+  START_MEMORY (watches);
   SHRINK_STACK (*stack);
+  STOP_MEMORY (watches);
 #ifndef COMPACT
   unsigned *new_begin_stack = BEGIN_STACK (*stack);
   const ptrdiff_t moved = (char *) new_begin_stack - (char *) old_begin_stack;
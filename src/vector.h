@@ -25,6 +25,7 @@ struct vectors
 {
   unsigneds stack;
   size_t usable;
+  sizes blocks[LD_MAX_VECTORS];
 };
 
 struct vector
@@ -48,6 +49,7 @@ void kissat_check_vectors (struct kissat *);
 
 unsigned *kissat_enlarge_vector (struct kissat *, vector *);
 void kissat_defrag_vectors (struct kissat *, size_t, vector *);
+void kissat_release_vectors (struct kissat *);
 void kissat_remove_from_vector (struct kissat *, vector *, unsigned);
 void kissat_resize_vector (struct kissat *, vector *, size_t);
 
@@ -1,11 +1,13 @@
 #include "allocate.h"
 #include "decide.h"
+#include "degrade.h"
 #include "dense.h"
 #include "inline.h"
 #include "phases.h"
 #include "print.h"
 #include "report.h"
 #include "rephase.h"
+#include "resources.h"
 #include "terminate.h"
 #include "walk.h"
 
@@ -34,9 +36,11 @@ make_tagged (bool binary, unsigned ref)
 
 struct counter
 {
+  tagged ref;
   unsigned count;
   unsigned weight;
   unsigned pos;
+  unsigned critical;
 };
 
 // *INDENT-OFF*
@@ -61,10 +65,10 @@ struct walker
 
   generator random;
 
+  unsigned *breaks;
   counter *counters;
   litpairs *binaries;
   value *saved;
-  tagged *refs;
   double *table;
 
   doubles scores;
@@ -78,6 +82,7 @@ struct walker
   uint64_t flipped;
 #ifndef QUIET
   uint64_t start;
+  double time;
   struct
   {
     uint64_t flipped;
@@ -91,7 +96,7 @@ dereference_literals (kissat * solver, walker * walker,
 		      unsigned counter_ref, unsigned *size_ptr)
 {
   assert (counter_ref < walker->clauses);
-  tagged tagged = walker->refs[counter_ref];
+  tagged tagged = walker->counters[counter_ref].ref;
   unsigned const *lits;
   if (tagged.binary)
     {
@@ -346,9 +351,9 @@ connect_binary_counters (walker * walker)
 {
   kissat *solver = walker->solver;
   value *values = solver->values;
-  tagged *refs = walker->refs;
   watches *all_watches = solver->watches;
   counter *counters = walker->counters;
+  unsigned *breaks = walker->breaks;
 
   assert (SIZE_STACK (*walker->binaries) <= UINT_MAX);
   const unsigned size = SIZE_STACK (*walker->binaries);
@@ -368,15 +373,22 @@ connect_binary_counters (walker * walker)
       if (!first_value || !second_value)
 	continue;
       assert (counter_ref < walker->clauses);
-      refs[counter_ref] = make_tagged (true, binary_ref);
       watches *first_watches = all_watches + first;
       watches *second_watches = all_watches + second;
       kissat_push_large_watch (solver, first_watches, counter_ref);
       kissat_push_large_watch (solver, second_watches, counter_ref);
       const unsigned count = (first_value > 0) + (second_value > 0);
       counter *counter = counters + counter_ref;
+      counter->ref = make_tagged (true, binary_ref);
       counter->count = count;
       counter->weight = weight;
+      counter->critical = 0;
+      if (first_value > 0)
+	counter->critical ^= first;
+      if (second_value > 0)
+	counter->critical ^= second;
+      if (count == 1)
+	breaks[counter->critical] += weight;
       if (!count)
 	{
 	  push_unsat (solver, walker, counters, counter_ref);
@@ -403,7 +415,7 @@ connect_large_counters (walker * walker, unsigned counter_ref)
   const value *const values = solver->values;
   ward *const arena = BEGIN_STACK (solver->arena);
   counter *counters = walker->counters;
-  tagged *refs = walker->refs;
+  unsigned *breaks = walker->breaks;
 
   unsigned unsat = 0;
   unsigned large = 0;
@@ -437,8 +449,7 @@ connect_large_counters (walker * walker, unsigned counter_ref)
       reference clause_ref = (ward *) c - arena;
       assert (clause_ref <= MAX_WALK_REF);
       assert (counter_ref < walker->clauses);
-      refs[counter_ref] = make_tagged (false, clause_ref);
-      unsigned count = 0, size = 0;
+      unsigned count = 0, size = 0, critical = 0;
       for (all_literals_in_clause (lit, c))
 	{
 	  const value value = values[lit];
@@ -451,11 +462,18 @@ connect_large_counters (walker * walker, unsigned counter_ref)
 	  kissat_push_large_watch (solver, watches, counter_ref);
 	  size++;
 	  if (value > 0)
-	    count++;
+	    {
+	      critical ^= lit;
+	      count++;
+	    }
 	}
-      counter *counter = walker->counters + counter_ref;
+      counter *counter = counters + counter_ref;
+      counter->ref = make_tagged (false, clause_ref);
       counter->count = count;
       counter->weight = clause_weight (walker, size);
+      counter->critical = critical;
+      if (count == 1)
+	breaks[critical] += counter->weight;
 
       if (!count)
 	{
@@ -542,8 +560,8 @@ init_walker (kissat * solver, walker * walker,
   else
     goto UNIFORM;
 
+  walker->breaks = kissat_calloc (solver, LITS, sizeof (unsigned));
   walker->counters = kissat_malloc (solver, clauses * sizeof (counter));
-  walker->refs = kissat_malloc (solver, clauses * sizeof (tagged));
 
   assert (!walker->size);
   const unsigned counter_ref = connect_binary_counters (walker);
@@ -578,6 +596,7 @@ init_walker_limit (kissat * solver, walker * walker)
   walker->flipped = 0;
 #ifndef QUIET
   walker->start = solver->statistics.walk_steps;
+  walker->time = kissat_process_time ();
   walker->report.minimum = UINT_MAX;
   walker->report.flipped = 0;
 #endif
@@ -589,8 +608,8 @@ release_walker (walker * walker)
   kissat *solver = walker->solver;
   kissat_dealloc (solver, walker->table, walker->exponents, sizeof (double));
   unsigned clauses = walker->clauses;
-  kissat_dealloc (solver, walker->refs, clauses, sizeof (tagged));
   kissat_dealloc (solver, walker->counters, clauses, sizeof (counter));
+  kissat_dealloc (solver, walker->breaks, LITS, sizeof (unsigned));
   RELEASE_STACK (walker->unsat);
   RELEASE_STACK (walker->scores);
   RELEASE_STACK (walker->trail);
@@ -599,26 +618,39 @@ release_walker (walker * walker)
   solver->values = walker->saved;
 }
 
+// The break value of a literal is the weight of the clauses which would
+// become unsatisfied by flipping it.  These are the clauses in which its
+// negation is the only true literal.  Instead of traversing the watches
+// of the negation for each candidate literal we maintain the break value
+// of every true literal incrementally while flipping (see 'make_clauses'
+// and 'break_clauses'), which reduces the cost of picking a literal to
+// the size of the picked clause.  The 'critical' field of a counter holds
+// the exclusive-or of its true literals and thus the only true literal
+// if its count is one.  We still charge one step per watch as when the
+// break value was computed by traversing the watches, such that the
+// meaning of 'walkeffort' does not change.
+
 static unsigned
 break_value (kissat * solver, walker * walker, value * values, unsigned lit)
 {
   assert (values[lit] < 0);
   const unsigned not_lit = NOT (lit);
+  const unsigned res = walker->breaks[not_lit];
   watches *watches = &WATCHES (not_lit);
-  unsigned steps = 1;
-  unsigned res = 0;
+  ADD (walk_steps, 1 + SIZE_WATCHES (*watches));
+#ifndef NDEBUG
+  unsigned expected = 0;
   for (all_binary_large_watches (watch, *watches))
     {
-      steps++;
       assert (!watch.type.binary);
       reference counter_ref = watch.large.ref;
       assert (counter_ref < walker->clauses);
       counter *counter = walker->counters + counter_ref;
       if (counter->count == 1)
-	res += counter->weight;
+	expected += counter->weight;
     }
-  ADD (walk_steps, steps);
-#ifdef NDEBUG
+  assert (expected == res);
+#else
   (void) values;
 #endif
   return res;
@@ -720,6 +752,7 @@ break_clauses (kissat * solver, walker * walker,
        LOGLIT (not_flipped));
   watches *watches = &WATCHES (not_flipped);
   counter *counters = walker->counters;
+  unsigned *breaks = walker->breaks;
   unsigned steps = 1;
   for (all_binary_large_watches (watch, *watches))
     {
@@ -729,8 +762,15 @@ break_clauses (kissat * solver, walker * walker,
       assert (counter_ref < walker->clauses);
       counter *counter = counters + counter_ref;
       assert (counter->count);
-      if (--counter->count)
+      counter->critical ^= not_flipped;
+      const unsigned count = --counter->count;
+      if (count == 1)
+	breaks[counter->critical] += counter->weight;
+      if (count)
 	continue;
+      assert (!counter->critical);
+      assert (breaks[not_flipped] >= counter->weight);
+      breaks[not_flipped] -= counter->weight;
       push_unsat (solver, walker, counters, counter_ref);
 #ifdef LOGGING
       broken++;
@@ -753,6 +793,7 @@ make_clauses (kissat * solver, walker * walker,
        LOGLIT (flipped));
   watches *watches = &WATCHES (flipped);
   counter *counters = walker->counters;
+  unsigned *breaks = walker->breaks;
   unsigned steps = 1;
 #ifdef LOGGING
   unsigned made = 0;
@@ -765,8 +806,16 @@ make_clauses (kissat * solver, walker * walker,
       assert (counter_ref < walker->clauses);
       counter *counter = counters + counter_ref;
       assert (counter->count < UINT_MAX);
-      if (counter->count++)
+      const unsigned count = counter->count++;
+      if (count == 1)
+	{
+	  assert (breaks[counter->critical] >= counter->weight);
+	  breaks[counter->critical] -= counter->weight;
+	}
+      counter->critical ^= flipped;
+      if (count)
 	continue;
+      breaks[flipped] += counter->weight;
       if (pop_unsat (solver, walker, counters, counter_ref, counter->pos))
 	steps++;
 #ifdef LOGGING
@@ -976,6 +1025,10 @@ local_search_round (walker * walker)
   kissat_very_verbose (solver,
     "flipping %" PRIu64 " literals took %" PRIu64 " steps (%.2f per flipped)",
     walker->flipped, steps, kissat_average (steps, walker->flipped));
+  const double time = kissat_process_time () - walker->time;
+  kissat_very_verbose (solver,
+    "flipping took %.2f seconds (%.0f flipped per second)",
+    time, kissat_average (walker->flipped, time));
   // *INDENT-ON*
   const unsigned after = walker->minimum;
   kissat_phase (solver, "walk", GET (walks),
@@ -1109,6 +1162,7 @@ walking_phase (kissat * solver, bool first_time, bool use_previous_phase)
   INIT_STACK (irredundant);
   INIT_STACK (redundant);
   kissat_enter_dense_mode (solver, &irredundant, &redundant);
+  START_MEMORY (walker);
   walker walker;
   init_walker (solver, &walker, &irredundant, use_previous_phase);
   init_walker_limit (solver, &walker);
@@ -1118,6 +1172,7 @@ walking_phase (kissat * solver, bool first_time, bool use_previous_phase)
   unsigned expected = walker.minimum;
 #endif
   release_walker (&walker);
+  STOP_MEMORY (walker);
   kissat_resume_sparse_mode (solver, false, &irredundant, &redundant);
   RELEASE_STACK (irredundant);
   RELEASE_STACK (redundant);
@@ -1129,6 +1184,13 @@ walking_phase (kissat * solver, bool first_time, bool use_previous_phase)
 bool
 kissat_walking (kissat * solver)
 {
+  if (solver->memory.degraded >= DEGRADED_SHRUNKEN)
+    {
+      kissat_extremely_verbose (solver, "can not walk since "
+				"memory usage is degraded");
+      return false;
+    }
+
   reference last_irredundant = solver->last_irredundant;
   if (last_irredundant == INVALID_REF)
     last_irredundant = SIZE_STACK (solver->arena);
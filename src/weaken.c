@@ -1,6 +1,21 @@
 #include "inline.h"
 #include "weaken.h"
 
+// Only enlarging the extension stack allocates, thus the memory category
+// is only switched on this slow path.
+
+static inline void
+push_extension (kissat * solver, extension ext)
+{
+  if (FULL_STACK (solver->extend))
+    {
+      START_MEMORY (extend);
+      ENLARGE_STACK (solver->extend);
+      STOP_MEMORY (extend);
+    }
+  PUSH_STACK (solver->extend, ext);
+}
+
 static void
 push_witness_literal (kissat * solver, unsigned ilit)
 {
@@ -9,7 +24,7 @@ push_witness_literal (kissat * solver, unsigned ilit)
   assert (elit);
   LOG2 ("pushing external witness literal %d on extension stack", elit);
   const extension ext = kissat_extension (true, elit);
-  PUSH_STACK (solver->extend, ext);
+  push_extension (solver, ext);
 }
 
 static void
@@ -26,7 +41,7 @@ push_clause_literal (kissat * solver, unsigned ilit)
       assert (elit);
       LOG2 ("pushing external clause literal %d on extension stack", elit);
       const extension ext = kissat_extension (false, elit);
-      PUSH_STACK (solver->extend, ext);
+      push_extension (solver, ext);
     }
 }
 
@@ -99,6 +99,31 @@ tissat_init_solver (kissat * solver)
   solver->watching = true;
 }
 
+// Pigeon hole formula with 'holes + 1' pigeons and a pairwise at-most-one
+// encoding of each hole, which is hard for resolution.
+
+void
+tissat_add_pigeon_hole_formula (kissat * solver, int holes)
+{
+  const int pigeons = holes + 1;
+#define PIGEON_IN_HOLE(P,H) (1 + (P) * holes + (H))
+  for (int p = 0; p < pigeons; p++)
+    {
+      for (int h = 0; h < holes; h++)
+	kissat_add (solver, PIGEON_IN_HOLE (p, h));
+      kissat_add (solver, 0);
+    }
+  for (int h = 0; h < holes; h++)
+    for (int p = 0; p < pigeons; p++)
+      for (int q = p + 1; q < pigeons; q++)
+	{
+	  kissat_add (solver, -PIGEON_IN_HOLE (p, h));
+	  kissat_add (solver, -PIGEON_IN_HOLE (q, h));
+	  kissat_add (solver, 0);
+	}
+#undef PIGEON_IN_HOLE
+}
+
 static bool
 find_test_directory (void)
 {
@@ -510,6 +535,9 @@ do { \
   SCHEDULE (solve);
   SCHEDULE (coverage);
   SCHEDULE (terminate);
+  SCHEDULE (limits);
+  SCHEDULE (share);
+  SCHEDULE (gauss);
 
 #ifndef NPROOFS
   if (tissat_found_drabt || tissat_found_drat_trim)
@@ -80,6 +80,7 @@ do { \
 } while (0)
 
 void tissat_init_solver (struct kissat *);
+void tissat_add_pigeon_hole_formula (struct kissat *, int holes);
 
 #define DECLARE_AND_INIT_SOLVER(SOLVER) \
   kissat dummy_solver, *solver = &dummy_solver; \
@@ -1,6 +1,8 @@
 #include "../src/allocate.h"
+#include "../src/degrade.h"
 #include "../src/error.h"
 
+#include <inttypes.h>
 #include <string.h>
 
 #include "test.h"
@@ -49,6 +51,89 @@ test_allocate_coverage (void)
   assert (!p);
 }
 
+static void
+test_allocate_categories (void)
+{
+  DECLARE_AND_INIT_SOLVER (solver);
+  const memory *memory = &solver->memory;
+  void *p = kissat_malloc (solver, 100);
+  assert (memory->current[MEMORY_other] == 100);
+  {
+    START_MEMORY (arena);
+    void *q = kissat_malloc (solver, 1000);
+    assert (memory->current[MEMORY_arena] == 1000);
+    {
+      START_MEMORY (kitten);
+      void *r = kissat_malloc (solver, 10);
+      kissat_free (solver, r, 10);
+      STOP_MEMORY (kitten);
+    }
+    assert (memory->category == MEMORY_arena);
+    kissat_free (solver, q, 1000);
+    STOP_MEMORY (arena);
+  }
+  assert (memory->category == MEMORY_other);
+  kissat_free (solver, p, 100);
+  assert (!memory->total);
+  assert (memory->peak == 1110);
+  for (unsigned i = 0; i < SIZE_MEMORY_CATEGORIES; i++)
+    assert (!memory->current[i]);
+  assert (memory->maximum[MEMORY_other] == 100);
+  assert (memory->maximum[MEMORY_arena] == 1000);
+  assert (memory->maximum[MEMORY_kitten] == 10);
+  assert (!memory->maximum[MEMORY_watches]);
+}
+
+static void
+test_allocate_usage (void)
+{
+  kissat *solver = kissat_init ();
+  tissat_init_solver (solver);
+  tissat_add_pigeon_hole_formula (solver, 6);
+  int res = kissat_solve (solver);
+  assert (res == 20);
+  struct kissat_memory_usage usage = kissat_get_memory_usage (solver);
+  unsigned long sum = 0;
+#define CHECK_CATEGORY(NAME) \
+do { \
+  assert (usage.NAME.current <= usage.NAME.peak); \
+  assert (usage.NAME.peak <= usage.total.peak); \
+  sum += usage.NAME.current; \
+  printf ("%-8s %10lu current %10lu peak bytes\n", #NAME, \
+	  usage.NAME.current, usage.NAME.peak); \
+} while (0)
+  CHECK_CATEGORY (arena);
+  CHECK_CATEGORY (cache);
+  CHECK_CATEGORY (extend);
+  CHECK_CATEGORY (kitten);
+  CHECK_CATEGORY (walker);
+  CHECK_CATEGORY (watches);
+  CHECK_CATEGORY (other);
+  assert (sum == usage.total.current);
+  assert (usage.total.current <= usage.total.peak);
+  assert (usage.arena.peak);
+  assert (usage.watches.peak);
+  kissat_release (solver);
+}
+
+static void
+test_allocate_limit (void)
+{
+  kissat *solver = kissat_init ();
+  tissat_init_solver (solver);
+  tissat_add_pigeon_hole_formula (solver, 9);
+  struct kissat_memory_usage usage = kissat_get_memory_usage (solver);
+  kissat_set_memory_limit (solver, usage.total.current + (1u << 16));
+  int res = kissat_solve (solver);
+  assert (!res);
+  assert (solver->statistics.memory_limit_hits == 1);
+  assert (solver->statistics.memory_reductions);
+  assert (solver->memory.degraded == DEGRADED_ISOLATED);
+  printf ("memory limit hit after %" PRIu64 " conflicts\n",
+	  solver->statistics.conflicts);
+  kissat_release (solver);
+}
+
 #ifndef ASAN
 
 #include <setjmp.h>
@@ -107,6 +192,9 @@ tissat_schedule_allocate (void)
 {
   SCHEDULE_FUNCTION (test_allocate_basic);
   SCHEDULE_FUNCTION (test_allocate_coverage);
+  SCHEDULE_FUNCTION (test_allocate_categories);
+  SCHEDULE_FUNCTION (test_allocate_usage);
+  SCHEDULE_FUNCTION (test_allocate_limit);
 #ifndef ASAN
   SCHEDULE_FUNCTION (test_allocate_error);
 #endif
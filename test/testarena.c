@@ -23,7 +23,7 @@ test_arena_basic (void)
       printf ("iteration %d\n", i);
       (void) kissat_allocate_clause (solver, size);
     }
-  RELEASE_STACK (solver->arena);
+  kissat_release_arena (solver);
 #ifdef METRICS
   assert (!solver->statistics.allocated_current);
 #endif
@@ -65,7 +65,7 @@ test_arena_realloc (void)
   for (all_clauses (c))
     count++;
   assert (count == n);
-  RELEASE_STACK (solver->arena);
+  kissat_release_arena (solver);
 #ifdef METRICS
   assert (!solver->statistics.allocated_current);
 #endif
@@ -95,7 +95,7 @@ test_arena_traverse (void)
       size++;
     }
   assert (found == n);
-  RELEASE_STACK (solver->arena);
+  kissat_release_arena (solver);
 #ifdef METRICS
   assert (!solver->statistics.allocated_current);
 #endif
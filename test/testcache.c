@@ -38,7 +38,34 @@ test_cache_manual (void)
   kissat_invalidate_cache (solver);
   kissat_insert_cache (solver, 1);
   kissat_release_cache (solver);
-  RELEASE_STACK (solver->nonces);
+  kissat_release_nonces (solver);
+  DEALLOC (solver->phases.saved, VARS);
+}
+
+static void
+test_cache_minimum (void)
+{
+  DECLARE_AND_INIT_SOLVER (solver);
+  assert (!kissat_minimum_cache_line (solver));
+  const unsigned vars = solver->vars = 4;
+  CALLOC (solver->phases.saved, VARS);
+  value *saved = solver->phases.saved;
+  memset (saved, 0xff, VARS);
+  kissat_insert_cache (solver, 5);
+  saved[1] = 1;
+  kissat_insert_cache (solver, 2);
+  saved[2] = 1;
+  kissat_insert_cache (solver, 3);
+  const line *line = kissat_minimum_cache_line (solver);
+  assert (line);
+  assert (line->unsatisfied == 2);
+  assert (!kissat_get_bit (line->bits, vars, 0));
+  assert (kissat_get_bit (line->bits, vars, 1));
+  assert (!kissat_get_bit (line->bits, vars, 2));
+  kissat_invalidate_cache (solver);
+  assert (!kissat_minimum_cache_line (solver));
+  kissat_release_cache (solver);
+  kissat_release_nonces (solver);
   DEALLOC (solver->phases.saved, VARS);
 }
 
@@ -92,12 +119,37 @@ test_cache_random (void)
       vars = (2 + (i & 1)) * vars;
     }
   kissat_release_cache (solver);
-  RELEASE_STACK (solver->nonces);
+  kissat_release_nonces (solver);
+}
+
+static void
+test_cache_phases (void)
+{
+  kissat *solver = kissat_init ();
+  tissat_init_solver (solver);
+  signed char phases[4] = { 0, 0, 0, 0 };
+  assert (kissat_get_cached_phases (solver, phases, 4) < 0);
+  kissat_add (solver, -1), kissat_add (solver, 0);
+  kissat_add (solver, 2), kissat_add (solver, -3), kissat_add (solver, 0);
+  assert (solver->vars == 3);
+  value *saved = solver->phases.saved;
+  memset (saved, 1, solver->vars);
+  saved[1] = -1;
+  kissat_insert_cache (solver, 1);
+  const int unsatisfied = kissat_get_cached_phases (solver, phases, 3);
+  assert (unsatisfied == 1);
+  assert (phases[1] == -1);
+  assert (phases[2] == -1);
+  assert (phases[3] == 0);
+  (void) unsatisfied;
+  kissat_release (solver);
 }
 
 void
 tissat_schedule_cache (void)
 {
   SCHEDULE_FUNCTION (test_cache_manual);
+  SCHEDULE_FUNCTION (test_cache_minimum);
   SCHEDULE_FUNCTION (test_cache_random);
+  SCHEDULE_FUNCTION (test_cache_phases);
 }
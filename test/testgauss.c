@@ -0,0 +1,115 @@
+#include "../src/internal.h"
+
+#include "test.h"
+
+#include <inttypes.h>
+
+static void
+add_xor (kissat * solver, int a, int b, int c, bool rhs)
+{
+  for (int signs = 0; signs < 8; signs++)
+    {
+      const int negated = !!(signs & 1) + !!(signs & 2) + !!(signs & 4);
+      if ((negated & 1) == rhs)
+	continue;
+      kissat_add (solver, (signs & 1) ? -a : a);
+      kissat_add (solver, (signs & 2) ? -b : b);
+      kissat_add (solver, (signs & 4) ? -c : c);
+      kissat_add (solver, 0);
+    }
+}
+
+// Two XOR chains over the same 'n' inputs, the second in permuted order,
+// with different outputs, which is hard for resolution.
+
+static kissat *
+new_parity_solver (int n)
+{
+  kissat *solver = kissat_init ();
+  tissat_init_solver (solver);
+  int first = 1, second = 1;
+  int next = n + 1;
+  for (int i = 1; i < n; i++)
+    {
+      const int a = next++;
+      add_xor (solver, a, first, i + 1, false);
+      first = a;
+      const int b = next++;
+      add_xor (solver, b, second, 1 + (7 * i) % n, false);
+      second = b;
+    }
+  kissat_add (solver, first);
+  kissat_add (solver, second);
+  kissat_add (solver, 0);
+  kissat_add (solver, -first);
+  kissat_add (solver, -second);
+  kissat_add (solver, 0);
+  return solver;
+}
+
+static void
+test_gauss_parity (void)
+{
+  kissat *solver = new_parity_solver (64);
+  const int res = kissat_solve (solver);
+  assert (res == 20);
+  printf ("%" PRIu64 " conflicts %" PRIu64 " Gauss-Jordan conflicts\n",
+	  solver->statistics.conflicts, solver->statistics.gauss_conflicts);
+  assert (solver->statistics.gauss_rebuilds);
+  assert (solver->statistics.gauss_conflicts);
+  assert (solver->statistics.conflicts < 100);
+  kissat_release (solver);
+}
+
+// Random XOR constraints satisfied by a planted assignment.
+
+#define PLANTED_VARS 200
+#define PLANTED_XORS 180
+
+static void
+test_gauss_satisfiable (void)
+{
+  const int vars = PLANTED_VARS, xors = PLANTED_XORS;
+  bool planted[PLANTED_VARS + 1];
+  int constraints[PLANTED_XORS][3];
+  srand (42);
+  for (int idx = 1; idx <= vars; idx++)
+    planted[idx] = rand () & 1;
+  kissat *solver = kissat_init ();
+  tissat_init_solver (solver);
+  for (int i = 0; i < xors; i++)
+    {
+      int *c = constraints[i];
+      c[0] = 1 + rand () % vars;
+      do
+	c[1] = 1 + rand () % vars;
+      while (c[1] == c[0]);
+      do
+	c[2] = 1 + rand () % vars;
+      while (c[2] == c[0] || c[2] == c[1]);
+      const bool rhs = planted[c[0]] ^ planted[c[1]] ^ planted[c[2]];
+      add_xor (solver, c[0], c[1], c[2], rhs);
+    }
+  const int res = kissat_solve (solver);
+  assert (res == 10);
+  printf ("%" PRIu64 " conflicts %" PRIu64 " Gauss-Jordan propagations\n",
+	  solver->statistics.conflicts,
+	  solver->statistics.gauss_propagations);
+  for (int i = 0; i < xors; i++)
+    {
+      const int *c = constraints[i];
+      const bool rhs = planted[c[0]] ^ planted[c[1]] ^ planted[c[2]];
+      bool parity = false;
+      for (int j = 0; j < 3; j++)
+	parity ^= kissat_value (solver, c[j]) > 0;
+      assert (parity == rhs);
+    }
+  kissat_release (solver);
+}
+
+void
+tissat_schedule_gauss (void)
+{
+  SCHEDULE_FUNCTION (test_gauss_parity);
+  SCHEDULE_FUNCTION (test_gauss_satisfiable);
+}
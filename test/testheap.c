@@ -91,6 +91,36 @@ test_heap_random (void)
 #undef N
 }
 
+static void
+test_heap_sorted (void)
+{
+#define N 1000
+  srand (42);
+  DECLARE_AND_INIT_SOLVER (solver);
+  heap dummy_heap, *heap = &dummy_heap;
+  memset (heap, 0, sizeof (struct heap));
+  kissat_resize_heap (solver, heap, N);
+  for (unsigned idx = 0; idx < N; idx++)
+    {
+      kissat_update_heap (solver, heap, idx, rand () % (N / 2));
+      kissat_push_heap (solver, heap, idx);
+    }
+  kissat_check_heap (heap);
+  double previous = N;
+  unsigned popped = 0;
+  while (!kissat_empty_heap (heap))
+    {
+      const unsigned idx = kissat_pop_max_heap (solver, heap);
+      const double score = kissat_get_heap_score (heap, idx);
+      assert (score <= previous);
+      previous = score;
+      popped++;
+    }
+  assert (popped == N);
+  kissat_release_heap (solver, heap);
+#undef N
+}
+
 static void
 test_heap_rescale (void)
 {
@@ -126,5 +156,6 @@ tissat_schedule_heap (void)
 {
   SCHEDULE_FUNCTION (test_heap_basic);
   SCHEDULE_FUNCTION (test_heap_random);
+  SCHEDULE_FUNCTION (test_heap_sorted);
   SCHEDULE_FUNCTION (test_heap_rescale);
 }
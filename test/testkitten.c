@@ -130,11 +130,54 @@ test_kitten_assumption_one_clause (void)
 #endif
 }
 
+static void
+test_kitten_flip_literal (void)
+{
+  DECLARE_AND_INIT_SOLVER (solver);
+  kitten *kitten = kitten_embedded (solver);
+  const unsigned a = 0, not_a = 1;
+  const unsigned b = 2;
+  kitten_binary (kitten, a, b);
+  kitten_assume (kitten, not_a);
+  int res = kitten_solve (kitten);
+  assert (res == 10);
+  (void) res;
+  assert (kitten_value (kitten, a) < 0);
+  assert (kitten_value (kitten, b) > 0);
+  bool flipped = kitten_flip_literal (kitten, b);
+  assert (!flipped);
+  assert (kitten_value (kitten, b) > 0);
+  flipped = kitten_flip_literal (kitten, a);
+  assert (!flipped);
+  assert (kitten_value (kitten, a) < 0);
+  kitten_assume (kitten, b);
+  res = kitten_solve (kitten);
+  assert (res == 10);
+  assert (kitten_value (kitten, b) > 0);
+  const signed char value_a = kitten_value (kitten, a);
+  flipped = kitten_flip_literal (kitten, a);
+  assert (flipped);
+  assert (kitten_value (kitten, a) == -value_a);
+  flipped = kitten_flip_literal (kitten, b);
+  assert (!flipped);
+  assert (kitten_value (kitten, b) > 0);
+  flipped = kitten_flip_literal (kitten, a);
+  assert (flipped);
+  assert (kitten_value (kitten, a) == value_a);
+  (void) value_a;
+  (void) flipped;
+  kitten_release (kitten);
+#ifdef METRICS
+  assert (!solver->statistics.allocated_current);
+#endif
+}
+
 void
 tissat_schedule_kitten (void)
 {
   SCHEDULE_FUNCTION (test_kitten_tie_and_shirt);
   SCHEDULE_FUNCTION (test_kitten_assumption_one_clause);
+  SCHEDULE_FUNCTION (test_kitten_flip_literal);
 
 #ifdef KITTEN
   char *kitten = malloc (strlen (tissat_root) + 16);
@@ -0,0 +1,66 @@
+#include "../src/internal.h"
+
+#include "test.h"
+
+#include <inttypes.h>
+
+static kissat *
+new_pigeon_hole_solver (int holes)
+{
+  kissat *solver = kissat_init ();
+  tissat_init_solver (solver);
+  tissat_add_pigeon_hole_formula (solver, holes);
+  return solver;
+}
+
+static void
+test_limits_ticks (void)
+{
+  kissat *solver = new_pigeon_hole_solver (7);
+  int res = kissat_solve (solver);
+  assert (res == 20);
+  const uint64_t conflicts = solver->statistics.conflicts;
+  const uint64_t ticks = SEARCH_AND_PROBING_TICKS;
+  kissat_release (solver);
+
+  solver = new_pigeon_hole_solver (7);
+  const unsigned slice = ticks / 10 + 1;
+  unsigned slices = 0;
+  do
+    {
+      kissat_set_ticks_limit (solver, slice);
+      res = kissat_solve (solver);
+      slices++;
+    }
+  while (!res);
+  assert (res == 20);
+  printf ("solved in %u slices of %u ticks\n", slices, slice);
+  assert (slices > 1);
+  assert (solver->statistics.conflicts == conflicts);
+  assert (SEARCH_AND_PROBING_TICKS == ticks);
+  kissat_release (solver);
+}
+
+static void
+test_limits_resume (void)
+{
+  kissat *solver = new_pigeon_hole_solver (6);
+  kissat_set_conflict_limit (solver, 10);
+  int res = kissat_solve (solver);
+  assert (!res);
+  assert (solver->statistics.conflicts == 10);
+  kissat_set_decision_limit (solver, 0);
+  res = kissat_solve (solver);
+  assert (!res);
+  res = kissat_solve (solver);
+  assert (res == 20);
+  assert (solver->statistics.searches == 3);
+  kissat_release (solver);
+}
+
+void
+tissat_schedule_limits (void)
+{
+  SCHEDULE_FUNCTION (test_limits_ticks);
+  SCHEDULE_FUNCTION (test_limits_resume);
+}
@@ -0,0 +1,196 @@
+#ifndef NOPTIONS
+
+#include "../src/internal.h"
+
+#include "test.h"
+
+#include <inttypes.h>
+
+#define MAX_SHARED_SIZE 8
+
+// A single solver sharing clauses with itself.  Clauses exported in one
+// epoch are only handed back after the next barrier and, if 'reverse' is
+// set, in reverse order and with their literals reversed.
+
+typedef struct loopback loopback;
+
+struct loopback
+{
+  bool reverse;
+  unsigned barriers;
+  unsigned long last_epoch;
+  int exported[MAX_SHARED_SIZE];
+  int produced[MAX_SHARED_SIZE];
+  ints pending;
+  ints ready;
+  unsigneds offsets;
+  size_t next;
+  kissat *solver;
+};
+
+static void
+consume (void *state, int size, int glue)
+{
+  loopback *host = state;
+  kissat *solver = host->solver;
+  PUSH_STACK (host->pending, size);
+  PUSH_STACK (host->pending, glue);
+  for (int i = 0; i < size; i++)
+    PUSH_STACK (host->pending, host->exported[i]);
+}
+
+static void
+barrier (void *state, unsigned long epoch)
+{
+  loopback *host = state;
+  kissat *solver = host->solver;
+  assert (epoch > host->last_epoch);
+  host->last_epoch = epoch;
+  host->barriers++;
+  CLEAR_STACK (host->ready);
+  CLEAR_STACK (host->offsets);
+  const int *p = BEGIN_STACK (host->pending);
+  const int *const end = END_STACK (host->pending);
+  while (p != end)
+    {
+      PUSH_STACK (host->offsets, SIZE_STACK (host->ready));
+      const int size = p[0];
+      for (int i = 0; i < size + 2; i++)
+	PUSH_STACK (host->ready, *p++);
+    }
+  CLEAR_STACK (host->pending);
+  host->next = 0;
+}
+
+static void
+produce (void *state, int **clause, int *size, int *glue)
+{
+  loopback *host = state;
+  const size_t clauses = SIZE_STACK (host->offsets);
+  if (host->next == clauses)
+    {
+      *clause = 0, *size = *glue = 0;
+      return;
+    }
+  const size_t i = host->next++;
+  const unsigned offset = PEEK_STACK (host->offsets,
+				      host->reverse ? clauses - 1 - i : i);
+  const int *c = BEGIN_STACK (host->ready) + offset;
+  *size = c[0], *glue = c[1];
+  for (int j = 0; j < c[0]; j++)
+    host->produced[j] = c[2 + (host->reverse ? c[0] - 1 - j : j)];
+  *clause = host->produced;
+}
+
+static kissat *
+new_sharing_solver (loopback * host, bool reverse)
+{
+  memset (host, 0, sizeof *host);
+  kissat *solver = kissat_init ();
+  tissat_init_solver (solver);
+  solver->options.shareepoch = 2e4;
+  host->reverse = reverse;
+  host->solver = solver;
+  kissat_set_clause_export_callback (solver, host, host->exported,
+				     MAX_SHARED_SIZE, consume);
+  kissat_set_clause_import_callback (solver, host, produce);
+  kissat_set_clause_sharing_barrier (solver, host, barrier);
+  tissat_add_pigeon_hole_formula (solver, 7);
+  return solver;
+}
+
+static void
+release_sharing_solver (loopback * host)
+{
+  kissat *solver = host->solver;
+  RELEASE_STACK (host->pending);
+  RELEASE_STACK (host->ready);
+  RELEASE_STACK (host->offsets);
+  kissat_release (solver);
+}
+
+static void
+test_share_deterministic (void)
+{
+  uint64_t conflicts = 0, ticks = 0;
+  unsigned long imported = 0;
+  unsigned barriers = 0;
+  for (int reverse = 0; reverse < 2; reverse++)
+    {
+      loopback host;
+      kissat *solver = new_sharing_solver (&host, reverse);
+      const int res = kissat_solve (solver);
+      assert (res == 20);
+      printf ("%s order: %u epochs %" PRIu64 " conflicts %lu imported\n",
+	      reverse ? "reverse" : "forward", host.barriers,
+	      solver->statistics.conflicts,
+	      solver->num_imported_external_clauses);
+      assert (host.barriers == solver->statistics.share_epochs);
+      if (reverse)
+	{
+	  assert (solver->statistics.conflicts == conflicts);
+	  assert (SEARCH_AND_PROBING_TICKS == ticks);
+	  assert (solver->num_imported_external_clauses == imported);
+	  assert (host.barriers == barriers);
+	}
+      else
+	{
+	  conflicts = solver->statistics.conflicts;
+	  ticks = SEARCH_AND_PROBING_TICKS;
+	  imported = solver->num_imported_external_clauses;
+	  barriers = host.barriers;
+	  assert (barriers > 1);
+	  assert (imported > 0);
+	}
+      release_sharing_solver (&host);
+    }
+}
+
+#if !defined(QUIET) || defined(COUNTERS)
+
+static void
+test_share_traced (void)
+{
+  loopback host;
+  kissat *solver = new_sharing_solver (&host, false);
+  solver->options.traceevents = 1e5;
+  const int res = kissat_solve (solver);
+  assert (res == 20);
+  const trace *trace = &solver->trace;
+  assert (trace->recorded < trace->size);
+  unsigned begin = 0, end = 0;
+  for (size_t i = 0; i < trace->recorded; i++)
+    {
+      const trace_event *event = trace->events + i;
+      if (strcmp (event->name, "export"))
+	continue;
+      if (event->phase == 'B')
+	begin++;
+      else if (event->phase == 'E')
+	end++;
+    }
+  printf ("traced %u export batches in %u epochs\n", end, host.barriers);
+  assert (begin == end);
+  assert (end == host.barriers);
+  release_sharing_solver (&host);
+}
+
+#endif
+
+void
+tissat_schedule_share (void)
+{
+  SCHEDULE_FUNCTION (test_share_deterministic);
+#if !defined(QUIET) || defined(COUNTERS)
+  SCHEDULE_FUNCTION (test_share_traced);
+#endif
+}
+
+#else
+
+void
+tissat_schedule_share (void)
+{
+}
+
+#endif
@@ -72,8 +72,17 @@ tissat_schedule_usage (void)
 	   "--eliminateinit=0 ../test/cnf/hard.cnf --profile=4");
       APP (0, "../test/cnf/hard.cnf --walkinitially -v -v -v "
 	   "--colors --conflicts=1e4");
+      APP (0, "../test/cnf/hard.cnf --profile=4 --profilecounters "
+	   "--conflicts=1e3");
+      APP (0, "../test/cnf/hard.cnf --trace=trace.json --traceevents=64 "
+	   "--conflicts=1e4");
+#elif defined(COUNTERS)
+      APP (0, "../test/cnf/hard.cnf --profile=4 --conflicts=1e3");
+      APP (0, "../test/cnf/hard.cnf --trace=trace.json --traceevents=64 "
+	   "--conflicts=1e4");
 #endif
 
+      APP (0, "--ticks=1e5 ../test/cnf/hard.cnf");
       APP (0, "--decisions=10 ../test/cnf/hard.cnf --no-reduce");
       APP (0, "--decisions=10 ../test/cnf/hard.cnf --no-rephase");
       APP (0, "--decisions=10 ../test/cnf/hard.cnf --no-restart");
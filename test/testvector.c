@@ -99,7 +99,49 @@ test_vector_basics (void)
 #ifndef QUIET
   RELEASE_STACK (solver->profiles.stack);
 #endif
-  RELEASE_STACK (*stack);
+  kissat_release_vectors (solver);
+#ifdef METRICS
+  assert (!solver->statistics.allocated_current);
+#endif
+}
+
+static void
+test_vector_reuse (void)
+{
+  DECLARE_AND_INIT_SOLVER (solver);
+  vector vector[4];
+  memset (vector, 0, sizeof vector);
+  solver->size = solver->vars = 2;
+  solver->watches = vector;
+  unsigneds *stack = &solver->vectors.stack;
+  kissat_push_vectors (solver, vector + 0, 0);
+  kissat_push_vectors (solver, vector + 1, 1);
+  kissat_push_vectors (solver, vector + 0, 0);
+  kissat_push_vectors (solver, vector + 1, 1);
+  assert (kissat_offset_vector (solver, vector + 0) == 3);
+  assert (kissat_offset_vector (solver, vector + 1) == 5);
+  const size_t size = SIZE_STACK (*stack);
+  const size_t usable = solver->vectors.usable;
+  assert (usable == 2);
+  unsigned *p = kissat_enlarge_vector (solver, vector + 2);
+  assert (p == BEGIN_STACK (*stack) + 2);
+  *p = 2;
+  kissat_dec_usable (solver);
+#ifdef COMPACT
+  vector[2].size++;
+#else
+  vector[2].end++;
+#endif
+  assert (kissat_offset_vector (solver, vector + 2) == 2);
+  assert (SIZE_STACK (*stack) == size);
+  assert (solver->vectors.usable == usable - 1);
+  for (unsigned i = 0; i < 3; i++)
+    for (all_vector (e, vector[i]))
+      assert (e == i);
+#ifndef QUIET
+  RELEASE_STACK (solver->profiles.stack);
+#endif
+  kissat_release_vectors (solver);
 #ifdef METRICS
   assert (!solver->statistics.allocated_current);
 #endif
@@ -148,5 +190,6 @@ void
 tissat_schedule_vector (void)
 {
   SCHEDULE_FUNCTION (test_vector_basics);
+  SCHEDULE_FUNCTION (test_vector_reuse);
   SCHEDULE_FUNCTION (test_vector_fatal);
 }